@@ -129,25 +129,24 @@ memcmp(
    const Tux64UInt8 * iter_s2;
    Tux64UInt8 byte_s1;
    Tux64UInt8 byte_s2;
-   int difference;
 
    /* this function spec. is so fucked up and incompatible with everything, */
-   /* we have no choice but to go fully hand-made here. */
+   /* we have no choice but to go fully hand-made here.  most callers only */
+   /* care about equality, so the word-wise comparison answers those, and */
+   /* only a mismatch is walked again to find the first differing byte. */
+   if (tux64_memory_compare_with_equal_lengths(s1, s2, (Tux64UInt32)n) == TUX64_BOOLEAN_TRUE) {
+      return 0;
+   }
 
    iter_s1 = (const Tux64UInt8 *)s1;
    iter_s2 = (const Tux64UInt8 *)s2;
 
-   difference = 0;
-
-   while (n != 0u) {
+   do {
       byte_s1 = *iter_s1++;
       byte_s2 = *iter_s2++;
-      n--;
-
-      difference += ((int)byte_s1 - (int)byte_s2);
-   }
+   } while (byte_s1 == byte_s2);
 
-   return difference;
+   return ((int)byte_s1 - (int)byte_s2);
 }
 
 __attribute__((TUX64_BOOT_BUILTIN_IMPLEMENTATION("abort"), noreturn))
@@ -0,0 +1,279 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/bulk.c - Implementations for bulk memory fills and     */
+/*    copies using RSP DMA.                                                   */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+#include "tux64-boot/bulk.h"
+
+#include <tux64/platform/mips/n64/memory-map.h>
+#include "tux64-boot/rsp.h"
+
+/* we use all of IMEM for staging and not DMEM for the same reason as the */
+/* framebuffer clear, which is to keep boot status codes intact. */
+#define TUX64_BOOT_BULK_STAGING_ADDRESS\
+   (TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_PHYSICAL_RSP_IMEM)
+#define TUX64_BOOT_BULK_STAGING_BYTES\
+   (0x1000u)
+
+#define TUX64_BOOT_BULK_ALIGNMENT\
+   (8u)
+
+/* below this, setting up the DMA transfers costs more than just letting the */
+/* CPU do all the work. */
+#define TUX64_BOOT_BULK_THRESHOLD_BYTES\
+   (0x100u)
+
+/* the number of bytes the CPU fills before the RSP takes over.  this must be */
+/* a multiple of the alignment and less than the threshold. */
+#define TUX64_BOOT_BULK_SEED_BYTES\
+   (0x80u)
+
+static volatile Tux64UInt8 *
+tux64_boot_bulk_uncached(
+   const void * address
+) {
+   return (volatile Tux64UInt8 *)tux64_platform_mips_n64_memory_map_direct_cached_to_direct_uncached(address);
+}
+
+static Tux64UInt32
+tux64_boot_bulk_head_bytes(
+   const void * address,
+   Tux64UInt32 bytes
+) {
+   Tux64UInt32 retn;
+
+   retn = (TUX64_LITERAL_UINT32(0u) - (Tux64UInt32)(Tux64UIntPtr)address) % TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_ALIGNMENT);
+   if (retn > bytes) {
+      retn = bytes;
+   }
+
+   return retn;
+}
+
+static void
+tux64_boot_bulk_dma(
+   Tux64UInt32 addr_rdram,
+   Tux64UInt32 bytes,
+   enum Tux64BootRspDmaDestination destination
+) {
+   struct Tux64BootRspDmaTransfer transfer;
+
+   transfer.addr_rsp_mem   = TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_STAGING_ADDRESS);
+   transfer.addr_rdram     = addr_rdram;
+   transfer.row_bytes_copy = (Tux64UInt16)(bytes - TUX64_LITERAL_UINT32(1u));
+   transfer.row_bytes_skip = TUX64_LITERAL_UINT16(0u);
+   transfer.row_count      = TUX64_LITERAL_UINT8(0u);
+
+   tux64_boot_rsp_dma_wait_queue();
+   tux64_boot_rsp_dma_start(&transfer, destination);
+   return;
+}
+
+static void
+tux64_boot_bulk_fill_cpu(
+   volatile Tux64UInt8 * dest,
+   const union Tux64Int64 * pattern,
+   Tux64UInt32 bytes
+) {
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      *dest = pattern->bytes[(Tux64UIntPtr)dest % TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_ALIGNMENT)];
+
+      dest++;
+      bytes--;
+   }
+
+   return;
+}
+
+static void
+tux64_boot_bulk_fill_cpu_aligned(
+   volatile Tux64UInt8 * dest,
+   const union Tux64Int64 * pattern,
+   Tux64UInt32 bytes
+) {
+   volatile Tux64UInt64 * iter;
+
+   /* 64-bit stores so we don't spend 8x as long on uncached writes */
+   iter = (volatile Tux64UInt64 *)dest;
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      *iter = pattern->uint;
+
+      iter++;
+      bytes -= TUX64_LITERAL_UINT32(sizeof(*iter));
+   }
+
+   return;
+}
+
+static void
+tux64_boot_bulk_copy_cpu(
+   volatile Tux64UInt8 * dest,
+   const volatile Tux64UInt8 * src,
+   Tux64UInt32 bytes
+) {
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      *dest = *src;
+
+      dest++;
+      src++;
+      bytes--;
+   }
+
+   return;
+}
+
+void
+tux64_boot_bulk_fill(
+   void * dest,
+   Tux64UInt64 pattern,
+   Tux64UInt32 bytes
+) {
+   union Tux64Int64 pattern_bytes;
+   volatile Tux64UInt8 * dest_uncached;
+   Tux64UInt32 addr_body;
+   Tux64UInt32 bytes_head;
+   Tux64UInt32 bytes_body;
+   Tux64UInt32 bytes_filled;
+   Tux64UInt32 bytes_staged;
+   Tux64UInt32 bytes_chunk;
+
+   pattern_bytes.uint = pattern;
+   dest_uncached = tux64_boot_bulk_uncached(dest);
+
+   if (bytes < TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_THRESHOLD_BYTES)) {
+      tux64_boot_bulk_fill_cpu(dest_uncached, &pattern_bytes, bytes);
+      return;
+   }
+
+   /* split into an unaligned head and tail for the CPU and an aligned body */
+   /* for the RSP.  since we're above the threshold, the body is always at */
+   /* least as large as the seed. */
+   bytes_head  = tux64_boot_bulk_head_bytes(dest, bytes);
+   bytes_body  = (bytes - bytes_head) & ~TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_ALIGNMENT - 1u);
+   addr_body   = (Tux64UInt32)(Tux64UIntPtr)dest + bytes_head;
+
+   tux64_boot_bulk_fill_cpu(dest_uncached, &pattern_bytes, bytes_head);
+   tux64_boot_bulk_fill_cpu(
+      &dest_uncached[bytes_head + bytes_body],
+      &pattern_bytes,
+      bytes - bytes_head - bytes_body
+   );
+   tux64_boot_bulk_fill_cpu_aligned(
+      &dest_uncached[bytes_head],
+      &pattern_bytes,
+      TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_SEED_BYTES)
+   );
+
+   /* instead of keeping a 4KiB pattern buffer around, we grow the pattern    */
+   /* from the seed using the destination itself.  each round reads back      */
+   /* everything filled so far into IMEM and writes it out after itself,      */
+   /* doubling the filled region until IMEM is full.  from then on, IMEM is   */
+   /* written out repeatedly.  the RSP executes transfers in order, so each   */
+   /* read always sees the result of the previous write.  visually:           */
+   /*                                                                         */
+   /*         [RDRAM]             [RSP DMA TRANSFER]         [RSP IMEM]       */
+   /*                                                                         */
+   /* body[0x0000..0x0080]  ----- 128B ----->  body[0x0000..0x0080] (seed)    */
+   /* body[0x0080..0x0100]  <---- 128B -----                                  */
+   /* body[0x0000..0x0100]  ----- 256B ----->  body[0x0000..0x0100]           */
+   /* body[0x0100..0x0200]  <---- 256B -----                                  */
+   /*                              ...                                        */
+   /* body[0x0000..0x1000]  ----- 4KiB ----->  body[0x0000..0x1000]           */
+   /* body[0x1000..0x2000]  <---- 4KiB -----                                  */
+   /* body[0x2000..0x3000]  <---- 4KiB -----                                  */
+   /*                              ...                                        */
+
+   bytes_filled = TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_SEED_BYTES);
+   bytes_staged = TUX64_LITERAL_UINT32(0u);
+   while (bytes_filled != bytes_body) {
+      if (bytes_staged != TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_STAGING_BYTES)) {
+         bytes_staged = bytes_filled;
+         if (bytes_staged > TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_STAGING_BYTES)) {
+            bytes_staged = TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_STAGING_BYTES);
+         }
+
+         tux64_boot_bulk_dma(addr_body, bytes_staged, TUX64_BOOT_RSP_DMA_DESTINATION_RSP_MEMORY);
+      }
+
+      bytes_chunk = bytes_body - bytes_filled;
+      if (bytes_chunk > bytes_staged) {
+         bytes_chunk = bytes_staged;
+      }
+
+      tux64_boot_bulk_dma(addr_body + bytes_filled, bytes_chunk, TUX64_BOOT_RSP_DMA_DESTINATION_RDRAM);
+      bytes_filled += bytes_chunk;
+   }
+
+   /* let the final DMA transfer complete in the background */
+   return;
+}
+
+void
+tux64_boot_bulk_copy(
+   void * dest,
+   const void * src,
+   Tux64UInt32 bytes
+) {
+   volatile Tux64UInt8 * dest_uncached;
+   const volatile Tux64UInt8 * src_uncached;
+   Tux64UInt32 addr_dest;
+   Tux64UInt32 addr_src;
+   Tux64UInt32 bytes_head;
+   Tux64UInt32 bytes_body;
+   Tux64UInt32 bytes_chunk;
+
+   dest_uncached  = tux64_boot_bulk_uncached(dest);
+   src_uncached   = tux64_boot_bulk_uncached(src);
+
+   /* RSP DMA can't shift data between different alignments, so mismatched */
+   /* ranges are stuck with the CPU. */
+   if (
+      bytes < TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_THRESHOLD_BYTES) ||
+      (((Tux64UIntPtr)dest ^ (Tux64UIntPtr)src) % TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_ALIGNMENT)) != TUX64_LITERAL_UINT32(0u)
+   ) {
+      tux64_boot_bulk_copy_cpu(dest_uncached, src_uncached, bytes);
+      return;
+   }
+
+   bytes_head  = tux64_boot_bulk_head_bytes(dest, bytes);
+   bytes_body  = (bytes - bytes_head) & ~TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_ALIGNMENT - 1u);
+   addr_dest   = (Tux64UInt32)(Tux64UIntPtr)dest + bytes_head;
+   addr_src    = (Tux64UInt32)(Tux64UIntPtr)src + bytes_head;
+
+   tux64_boot_bulk_copy_cpu(dest_uncached, src_uncached, bytes_head);
+   tux64_boot_bulk_copy_cpu(
+      &dest_uncached[bytes_head + bytes_body],
+      &src_uncached[bytes_head + bytes_body],
+      bytes - bytes_head - bytes_body
+   );
+
+   /* bounce every chunk through IMEM, since the RSP can only transfer */
+   /* between RDRAM and its own memory. */
+   while (bytes_body != TUX64_LITERAL_UINT32(0u)) {
+      bytes_chunk = bytes_body;
+      if (bytes_chunk > TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_STAGING_BYTES)) {
+         bytes_chunk = TUX64_LITERAL_UINT32(TUX64_BOOT_BULK_STAGING_BYTES);
+      }
+
+      tux64_boot_bulk_dma(addr_src, bytes_chunk, TUX64_BOOT_RSP_DMA_DESTINATION_RSP_MEMORY);
+      tux64_boot_bulk_dma(addr_dest, bytes_chunk, TUX64_BOOT_RSP_DMA_DESTINATION_RDRAM);
+
+      addr_src    += bytes_chunk;
+      addr_dest   += bytes_chunk;
+      bytes_body  -= bytes_chunk;
+   }
+
+   /* let the final DMA transfer complete in the background */
+   return;
+}
+
+void
+tux64_boot_bulk_wait_idle(void) {
+   tux64_boot_rsp_dma_wait_idle();
+   return;
+}
+
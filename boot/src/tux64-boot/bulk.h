@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/bulk.h - Header for bulk memory fills and copies using */
+/*    RSP DMA.                                                                */
+/*----------------------------------------------------------------------------*/
+
+#ifndef _TUX64_BOOT_BULK_H
+#define _TUX64_BOOT_BULK_H
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+
+/*----------------------------------------------------------------------------*/
+/* These functions stage data through RSP IMEM and let the RSP DMA engine do  */
+/* the heavy lifting, falling back to the CPU for small ranges and for the    */
+/* unaligned bytes at either end of a range.  RSP IMEM is clobbered, so       */
+/* anything previously uploaded there must be uploaded again.                 */
+/*                                                                            */
+/* All addresses must be in the cached segment.  The CPU only ever touches    */
+/* memory through the uncached segment, and none of these functions perform   */
+/* cache maintenance.  Before calling, the caller must make sure there are no */
+/* dirty data cache lines over the source and destination.  After calling,    */
+/* the transfer may still be ongoing in the background, so                    */
+/* tux64_boot_bulk_wait_idle() must be called before the destination is       */
+/* accessed, followed by invalidating the data cache over the destination if  */
+/* it will be accessed through the cached segment.                            */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* Fills 'bytes' bytes at 'dest' with a repeating 8-byte pattern.  'pattern'  */
+/* is laid out as if it were stored to every 8-byte aligned address, so the   */
+/* byte at 'dest + i' is the byte at index ((dest + i) % 8) of 'pattern' in   */
+/* memory.  The RSP DMA engine must be available to queue a DMA transfer.     */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_bulk_fill(
+   void * dest,
+   Tux64UInt64 pattern,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+/* Copies 'bytes' bytes from 'src' to 'dest'.  The two ranges must not        */
+/* overlap.  RSP DMA is only used if 'dest' and 'src' have the same alignment */
+/* relative to 8 bytes, otherwise the entire copy is done by the CPU.  The    */
+/* RSP DMA engine must be available to queue a DMA transfer.                  */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_bulk_copy(
+   void * dest,
+   const void * src,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+/* Waits for all fills and copies to finish.                                  */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_bulk_wait_idle(void);
+
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_BOOT_BULK_H */
+
@@ -9,6 +9,7 @@
 #include "tux64-boot/cache.h"
 
 #include <tux64/platform/mips/vr4300/cache.h>
+#include <tux64/platform/mips/n64/memory-map.h>
 
 typedef void (*Tux64BootCacheOperation)(
    const void * address
@@ -44,16 +45,62 @@ tux64_boot_cache_operation(
    return;
 }
 
+/* index operations select a line by the low bits of the address alone, so */
+/* walking any cached address range the size of the cache visits every line */
+/* exactly once. */
+static void
+tux64_boot_cache_operation_index(
+   Tux64UInt32 bytes_per_line,
+   Tux64UInt32 line_count,
+   Tux64BootCacheOperation cache_operation
+) {
+   tux64_boot_cache_operation(
+      (const void *)TUX64_LITERAL_UINTPTR(TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_SEGMENT_DIRECT_CACHED),
+      bytes_per_line * line_count,
+      bytes_per_line,
+      cache_operation
+   );
+   return;
+}
+
+/* hit operations cost one instruction per line in the range, while index */
+/* operations cost one instruction per line in the whole cache.  thus, once */
+/* the range covers at least as many lines as the cache holds, operating on */
+/* the whole cache is never slower.  this is only valid when */
+/* 'index_operation' has the same effect on lines inside the range as */
+/* 'hit_operation', and doesn't harm lines outside of it. */
+static void
+tux64_boot_cache_operation_planned(
+   const void * address,
+   Tux64UInt32 bytes,
+   Tux64UInt32 bytes_per_line,
+   Tux64UInt32 line_count,
+   Tux64BootCacheOperation hit_operation,
+   Tux64BootCacheOperation index_operation
+) {
+   if (bytes >= bytes_per_line * line_count) {
+      tux64_boot_cache_operation_index(bytes_per_line, line_count, index_operation);
+      return;
+   }
+
+   tux64_boot_cache_operation(address, bytes, bytes_per_line, hit_operation);
+   return;
+}
+
 void
 tux64_boot_cache_invalidate_instruction(
    const void * address,
    Tux64UInt32 bytes
 ) {
-   tux64_boot_cache_operation(
+   /* the instruction cache is never dirty, so invalidating lines outside */
+   /* the range only costs a refill. */
+   tux64_boot_cache_operation_planned(
       address,
       bytes,
       TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_VR4300_CACHE_BYTES_PER_LINE_INSTRUCTION),
-      tux64_platform_mips_vr4300_cache_operation_instruction_hit_invalidate
+      TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_VR4300_CACHE_LINE_COUNT_INSTRUCTION),
+      tux64_platform_mips_vr4300_cache_operation_instruction_hit_invalidate,
+      tux64_platform_mips_vr4300_cache_operation_instruction_index_invalidate
    );
    return;
 }
@@ -63,6 +110,10 @@ tux64_boot_cache_invalidate_data(
    const void * address,
    Tux64UInt32 bytes
 ) {
+   /* there's no index operation which invalidates without writing back, and */
+   /* writing back a dirty line inside the range would clobber whatever was */
+   /* just written behind the cache's back.  thus, this always uses hit */
+   /* operations. */
    tux64_boot_cache_operation(
       address,
       bytes,
@@ -87,11 +138,15 @@ tux64_boot_cache_flush_data(
    const void * address,
    Tux64UInt32 bytes
 ) {
-   tux64_boot_cache_operation(
+   /* also invalidating the lines is harmless, since everything is written */
+   /* back to RDRAM first. */
+   tux64_boot_cache_operation_planned(
       address,
       bytes,
       TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_VR4300_CACHE_BYTES_PER_LINE_DATA),
-      tux64_platform_mips_vr4300_cache_operation_data_hit_write_back
+      TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_VR4300_CACHE_LINE_COUNT_DATA),
+      tux64_platform_mips_vr4300_cache_operation_data_hit_write_back,
+      tux64_platform_mips_vr4300_cache_operation_data_index_write_back_invalidate
    );
    return;
 }
@@ -12,7 +12,8 @@
 #include "tux64-boot/tux64-boot.h"
 
 /*----------------------------------------------------------------------------*/
-/* Invalidate instruction cache in the range specified.                       */
+/* Invalidate instruction cache in the range specified.  Ranges at least as   */
+/* large as the instruction cache invalidate the whole cache instead.         */
 /*----------------------------------------------------------------------------*/
 void
 tux64_boot_cache_invalidate_instruction(
@@ -39,7 +40,8 @@ tux64_boot_cache_invalidate(
 );
 
 /*----------------------------------------------------------------------------*/
-/* Flush data cache to RDRAM in the range specified.                          */
+/* Flush data cache to RDRAM in the range specified.  Ranges at least as      */
+/* large as the data cache flush and invalidate the whole cache instead.      */
 /*----------------------------------------------------------------------------*/
 void
 tux64_boot_cache_flush_data(
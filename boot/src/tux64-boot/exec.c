@@ -10,14 +10,145 @@
 #include "tux64-boot/exec.h"
 
 #include <tux64/endian.h>
+#include <tux64/memory.h>
 #include <tux64/platform/mips/n64/memory-map.h>
+#include <tux64/platform/mips/n64/boot.h>
+#include <tux64/platform/mips/vr4300/cop0.h>
 #include "tux64-boot/layout.h"
 #include "tux64-boot/load.h"
+#include "tux64-boot/header.h"
+#include "tux64-boot/cache.h"
+#include "tux64-boot/bulk.h"
 
 __attribute__((section(".kernel_arguments")))
 extern struct Tux64BootExecKernelArguments
 tux64_boot_exec_kernel_arguments;
 
+/* a region which is still in use when the kernel starts.  these are stored */
+/* in the native endian until they're written to the memory map. */
+struct Tux64BootExecKernelMemoryRegionUsed {
+   Tux64UInt32 address;
+   Tux64UInt32 bytes;
+   enum Tux64BootExecKernelMemoryType type;
+};
+
+#define TUX64_BOOT_EXEC_KERNEL_MEMORY_REGIONS_USED\
+   4u
+
+static Tux64UInt32
+tux64_boot_exec_kernel_arguments_memory_map_push(
+   struct Tux64BootExecKernelArguments * arguments,
+   Tux64UInt32 entries,
+   Tux64UInt32 address,
+   Tux64UInt32 bytes,
+   enum Tux64BootExecKernelMemoryType type
+) {
+   struct Tux64BootExecKernelArgumentsMemoryRegion * region;
+
+   region = &arguments->memory_map[entries];
+   region->address   = tux64_endian_convert_uint32(address, TUX64_ENDIAN_FORMAT_BIG);
+   region->bytes     = tux64_endian_convert_uint32(bytes, TUX64_ENDIAN_FORMAT_BIG);
+   region->type      = tux64_endian_convert_uint32((Tux64UInt32)type, TUX64_ENDIAN_FORMAT_BIG);
+
+   return entries + TUX64_LITERAL_UINT32(1u);
+}
+
+static void
+tux64_boot_exec_kernel_arguments_memory_map_initialize(
+   struct Tux64BootExecKernelArguments * arguments,
+   Tux64UInt32 total_memory,
+   Tux64UInt32 framebuffer_address,
+   Tux64UInt32 framebuffer_bytes
+) {
+   struct Tux64BootExecKernelMemoryRegionUsed used [TUX64_BOOT_EXEC_KERNEL_MEMORY_REGIONS_USED];
+   struct Tux64BootExecKernelMemoryRegionUsed region;
+   Tux64UInt32 used_count;
+   Tux64UInt32 address_free;
+   Tux64UInt32 address_end;
+   Tux64UInt32 entries;
+   Tux64UInt32 i;
+   Tux64UInt32 j;
+
+   used[0u].address  = tux64_boot_load_allocations.required.kernel.address;
+   used[0u].bytes    = tux64_boot_header_file_kernel()->image.memory;
+   used[0u].type     = TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_KERNEL;
+   used[1u].address  = tux64_boot_load_allocations.optional.initramfs.address;
+   used[1u].bytes    = tux64_boot_header_file_initramfs()->length;
+   used[1u].type     = TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_INITRAMFS;
+   used[2u].address  = tux64_boot_load_allocations.optional.command_line.address;
+   used[2u].bytes    = tux64_boot_header_file_command_line()->length;
+   used[2u].type     = TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_COMMAND_LINE;
+   used[3u].address  = framebuffer_address;
+   used[3u].bytes    = framebuffer_bytes;
+   used[3u].type     = TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_RESERVED;
+
+   /* insertion sort by address, dropping empty regions as we go.  the load */
+   /* allocator guarantees none of these overlap, and the framebuffer is */
+   /* only handed off when nothing was loaded over it. */
+   used_count = TUX64_LITERAL_UINT32(0u);
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_BOOT_EXEC_KERNEL_MEMORY_REGIONS_USED)) {
+      region = used[i];
+      i++;
+
+      /* this never overwrites a region we haven't read yet, since there */
+      /* are never more sorted regions than regions read so far. */
+      if (region.bytes != TUX64_LITERAL_UINT32(0u)) {
+         j = used_count;
+         while (j != TUX64_LITERAL_UINT32(0u) && used[j - 1u].address > region.address) {
+            used[j] = used[j - 1u];
+            j--;
+         }
+
+         used[j] = region;
+         used_count++;
+      }
+   }
+
+   /* everything between the used regions is free, including whatever the */
+   /* bootloader itself left behind. */
+   address_free   = TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_RDRAM_CACHED);
+   address_end    = address_free + total_memory;
+   entries        = TUX64_LITERAL_UINT32(0u);
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != used_count) {
+      if (used[i].address > address_free) {
+         entries = tux64_boot_exec_kernel_arguments_memory_map_push(
+            arguments,
+            entries,
+            address_free,
+            used[i].address - address_free,
+            TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_FREE
+         );
+      }
+
+      entries = tux64_boot_exec_kernel_arguments_memory_map_push(
+         arguments,
+         entries,
+         used[i].address,
+         used[i].bytes,
+         used[i].type
+      );
+
+      address_free = used[i].address + used[i].bytes;
+      i++;
+   }
+
+   if (address_end > address_free) {
+      entries = tux64_boot_exec_kernel_arguments_memory_map_push(
+         arguments,
+         entries,
+         address_free,
+         address_end - address_free,
+         TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_FREE
+      );
+   }
+
+   arguments->memory_map_entries = tux64_endian_convert_uint32(entries, TUX64_ENDIAN_FORMAT_BIG);
+   return;
+}
+
 void
 tux64_boot_exec_kernel_arguments_initialize(
    Tux64UInt32 initramfs_address,
@@ -33,6 +164,186 @@ tux64_boot_exec_kernel_arguments_initialize(
    arguments->initramfs_bytes       = tux64_endian_convert_uint32(initramfs_bytes, TUX64_ENDIAN_FORMAT_BIG);
    arguments->command_line_address  = tux64_endian_convert_uint32(command_line_address, TUX64_ENDIAN_FORMAT_BIG);
    arguments->total_memory          = tux64_endian_convert_uint32(total_memory, TUX64_ENDIAN_FORMAT_BIG);
+
+   arguments->framebuffer.address   = TUX64_LITERAL_UINT32(0u);
+   arguments->framebuffer.width     = TUX64_LITERAL_UINT32(0u);
+   arguments->framebuffer.height    = TUX64_LITERAL_UINT32(0u);
+   arguments->framebuffer.stride    = TUX64_LITERAL_UINT32(0u);
+   arguments->framebuffer.format    = tux64_endian_convert_uint32(
+      (Tux64UInt32)TUX64_BOOT_EXEC_KERNEL_FRAMEBUFFER_FORMAT_NONE,
+      TUX64_ENDIAN_FORMAT_BIG
+   );
+
+   tux64_boot_exec_kernel_arguments_memory_map_initialize(
+      arguments,
+      total_memory,
+      TUX64_LITERAL_UINT32(0u),
+      TUX64_LITERAL_UINT32(0u)
+   );
+   return;
+}
+
+void
+tux64_boot_exec_kernel_arguments_framebuffer(
+   Tux64UInt32 address,
+   Tux64UInt32 width,
+   Tux64UInt32 height,
+   Tux64UInt32 stride,
+   enum Tux64BootExecKernelFramebufferFormat format
+) {
+   struct Tux64BootExecKernelArguments * arguments;
+   struct Tux64BootExecKernelArgumentsFramebuffer * framebuffer;
+
+   arguments   = &tux64_boot_exec_kernel_arguments;
+   framebuffer = &arguments->framebuffer;
+
+   framebuffer->address = tux64_endian_convert_uint32(address, TUX64_ENDIAN_FORMAT_BIG);
+   framebuffer->width   = tux64_endian_convert_uint32(width, TUX64_ENDIAN_FORMAT_BIG);
+   framebuffer->height  = tux64_endian_convert_uint32(height, TUX64_ENDIAN_FORMAT_BIG);
+   framebuffer->stride  = tux64_endian_convert_uint32(stride, TUX64_ENDIAN_FORMAT_BIG);
+   framebuffer->format  = tux64_endian_convert_uint32((Tux64UInt32)format, TUX64_ENDIAN_FORMAT_BIG);
+
+   /* the memory map was already built without the framebuffer, so we build */
+   /* it again with the framebuffer reserved.  converting from big-endian is */
+   /* the same as converting to it. */
+   tux64_boot_exec_kernel_arguments_memory_map_initialize(
+      arguments,
+      tux64_endian_convert_uint32(arguments->total_memory, TUX64_ENDIAN_FORMAT_BIG),
+      address,
+      stride * height
+   );
+   return;
+}
+
+void
+tux64_boot_exec_kernel_timing_initialize(
+   Tux64UInt32 stage0_end,
+   Tux64UInt32 stage1_start
+) {
+   struct Tux64BootExecKernelArgumentsTiming * timing;
+   Tux64UInt32 i;
+
+   timing = &tux64_boot_exec_kernel_arguments.timing;
+
+   timing->version      = tux64_endian_convert_uint32(TUX64_LITERAL_UINT32(TUX64_BOOT_EXEC_KERNEL_ARGUMENTS_TIMING_VERSION), TUX64_ENDIAN_FORMAT_BIG);
+   timing->stage0_end   = tux64_endian_convert_uint32(stage0_end, TUX64_ENDIAN_FORMAT_BIG);
+   timing->stage1_start = tux64_endian_convert_uint32(stage1_start, TUX64_ENDIAN_FORMAT_BIG);
+   timing->kernel_start = TUX64_LITERAL_UINT32(0u);
+
+   /* zero is the same in either endian, and marks files which never load. */
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_BOOT_EXEC_KERNEL_ARGUMENTS_TIMING_FILES)) {
+      timing->files[i].start  = TUX64_LITERAL_UINT32(0u);
+      timing->files[i].end    = TUX64_LITERAL_UINT32(0u);
+      i++;
+   }
+
+   return;
+}
+
+void
+tux64_boot_exec_kernel_timing_file(
+   enum Tux64BootExecKernelTimingFile file,
+   Tux64UInt32 start,
+   Tux64UInt32 end
+) {
+   struct Tux64BootExecKernelArgumentsTimingFile * timing;
+
+   timing = &tux64_boot_exec_kernel_arguments.timing.files[file];
+
+   timing->start  = tux64_endian_convert_uint32(start, TUX64_ENDIAN_FORMAT_BIG);
+   timing->end    = tux64_endian_convert_uint32(end, TUX64_ENDIAN_FORMAT_BIG);
+   return;
+}
+
+static void
+tux64_boot_exec_kernel_segment_place(
+   Tux64UInt8 * base,
+   const struct Tux64PlatformMipsN64BootHeaderKernelSegment * segment,
+   Tux64UInt32 packed_offset
+) {
+   Tux64UInt8 * dest;
+   const Tux64UInt8 * src;
+   Tux64UInt32 tail_bytes;
+
+   dest        = &base[segment->offset];
+   src         = &base[packed_offset];
+   tail_bytes  = segment->memory - segment->length;
+
+   /* this is the common case for a kernel with a single segment, so don't */
+   /* waste any time on cache maintenance. */
+   if (segment->offset == packed_offset && tail_bytes == TUX64_LITERAL_UINT32(0u)) {
+      return;
+   }
+
+   /* the bulk engine bypasses the data cache, so nothing dirty can be left */
+   /* over either range. */
+   tux64_boot_cache_flush_data(src, segment->length);
+   tux64_boot_cache_flush_data(dest, segment->memory);
+
+   if (segment->offset != packed_offset) {
+      if (packed_offset + segment->length <= segment->offset) {
+         tux64_boot_bulk_copy(dest, src, segment->length);
+      } else {
+         /* the RSP can't handle overlapping copies, but this only happens */
+         /* when a segment moves by less than its own length. */
+         tux64_memory_move(dest, src, segment->length);
+         tux64_boot_cache_flush_data(dest, segment->length);
+      }
+   }
+
+   /* zero-initialize .bss and friends */
+   tux64_boot_bulk_fill(
+      &dest[segment->length],
+      TUX64_LITERAL_UINT64(0u),
+      tail_bytes
+   );
+   tux64_boot_bulk_wait_idle();
+
+   /* the code was just written behind the data cache's back, so make sure */
+   /* it holds nothing stale.  the instruction cache is handled once all */
+   /* segments have been placed. */
+   tux64_boot_cache_invalidate_data(dest, segment->memory);
+   return;
+}
+
+void
+tux64_boot_exec_kernel_segments_place(
+   Tux64UInt32 load_address
+) {
+   const struct Tux64PlatformMipsN64BootHeaderFileKernel * kernel;
+   Tux64UInt8 * base;
+   Tux64UInt32 packed_offsets [TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX];
+   Tux64UInt32 packed_end;
+   Tux64UInt32 i;
+
+   kernel         = tux64_boot_header_file_kernel();
+   base           = (Tux64UInt8 *)(Tux64UIntPtr)load_address;
+   packed_end     = TUX64_LITERAL_UINT32(0u);
+
+   /* the segments were loaded back-to-back starting at the load address, */
+   /* each padded to the same alignment as its final location, so the bulk */
+   /* engine never has to fall back to the CPU to shift them. */
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != kernel->segment_count) {
+      packed_end += tux64_platform_mips_n64_boot_kernel_segment_padding(packed_end, kernel->segments[i].offset);
+      packed_offsets[i] = packed_end;
+      packed_end += kernel->segments[i].length;
+      i++;
+   }
+
+   /* mkrom guarantees each segment's final location is never before its */
+   /* packed location.  thus, placing segments from last to first never */
+   /* overwrites a segment which hasn't been placed yet. */
+   i = kernel->segment_count;
+   while (i != TUX64_LITERAL_UINT32(0u)) {
+      i--;
+      tux64_boot_exec_kernel_segment_place(base, &kernel->segments[i], packed_offsets[i]);
+   }
+
+   /* a single pass over the whole image right before starting the kernel, */
+   /* which is almost always larger than the instruction cache anyways. */
+   tux64_boot_cache_invalidate_instruction(base, kernel->image.memory);
    return;
 }
 
@@ -60,6 +371,12 @@ tux64_boot_exec_kernel(
    fw_arg2 = tux64_endian_convert_uint32(fw_arg2_u32, TUX64_ENDIAN_FORMAT_BIG);
    fw_arg3 = tux64_endian_convert_uint32(fw_arg3_u32, TUX64_ENDIAN_FORMAT_BIG);
 
+   /* as late as possible, so this includes placing the kernel's segments. */
+   tux64_boot_exec_kernel_arguments.timing.kernel_start = tux64_endian_convert_uint32(
+      tux64_platform_mips_vr4300_cop0_register_read_count(),
+      TUX64_ENDIAN_FORMAT_BIG
+   );
+
    /* need to write asm explicitly so compiler doesn't bugger up the jump. */
    /* also need .set noreorder so assembler doesn't insert useless nops. */
    __asm__ volatile (
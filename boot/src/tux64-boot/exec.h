@@ -12,19 +12,173 @@
 #include "tux64-boot/tux64-boot.h"
 #include "tux64-boot/load.h"
 
+/* kernel + initramfs + command line + framebuffer, and a free region before */
+/* each of them and after the last one. */
+#define TUX64_BOOT_EXEC_KERNEL_ARGUMENTS_MEMORY_MAP_ENTRIES\
+   9u
+
+/*----------------------------------------------------------------------------*/
+/* Describes what a region in the kernel's memory map is used for when the    */
+/* kernel is started.                                                         */
+/*                                                                            */
+/* TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_FREE - Nothing is stored here, so the   */
+/*    kernel can use it right away.  This includes everything left behind by  */
+/*    the bootloader itself.                                                  */
+/*                                                                            */
+/* TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_KERNEL - The kernel image, including    */
+/*    its zero-initialized memory.                                            */
+/*                                                                            */
+/* TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_INITRAMFS - The initramfs image, which  */
+/*    can be freed once it's unpacked.                                        */
+/*                                                                            */
+/* TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_COMMAND_LINE - The command line, which  */
+/*    can be freed once it's copied.                                          */
+/*                                                                            */
+/* TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_RESERVED - Still in use, and must never */
+/*    be touched by the kernel.                                               */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootExecKernelMemoryType {
+   TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_FREE         = 0u,
+   TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_KERNEL       = 1u,
+   TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_INITRAMFS    = 2u,
+   TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_COMMAND_LINE = 3u,
+   TUX64_BOOT_EXEC_KERNEL_MEMORY_TYPE_RESERVED     = 4u
+};
+
+/*----------------------------------------------------------------------------*/
+/* A single region in the kernel's memory map.  'type' is one of the values   */
+/* in enum Tux64BootExecKernelMemoryType.                                     */
+/*----------------------------------------------------------------------------*/
+struct Tux64BootExecKernelArgumentsMemoryRegion {
+   Tux64UInt32 address;
+   Tux64UInt32 bytes;
+   Tux64UInt32 type;
+};
+
+/* bumped whenever the layout of struct Tux64BootExecKernelArgumentsTiming */
+/* changes, so the kernel can tell whether it knows how to read it. */
+#define TUX64_BOOT_EXEC_KERNEL_ARGUMENTS_TIMING_VERSION\
+   1u
+
+/*----------------------------------------------------------------------------*/
+/* Identifies each file with load timings passed to the kernel.               */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootExecKernelTimingFile {
+   TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_KERNEL       = 0u,
+   TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_INITRAMFS    = 1u,
+   TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_COMMAND_LINE = 2u,
+   TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_STAGE2       = 3u
+};
+
+#define TUX64_BOOT_EXEC_KERNEL_ARGUMENTS_TIMING_FILES\
+   4u
+
+/*----------------------------------------------------------------------------*/
+/* When a single file started loading, and when it finished loading and       */
+/* being verified.  Both are zero if the file was never loaded.               */
+/*----------------------------------------------------------------------------*/
+struct Tux64BootExecKernelArgumentsTimingFile {
+   Tux64UInt32 start;
+   Tux64UInt32 end;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Timestamps for each stage of the boot process.  Each timestamp is the      */
+/* value of the COP0 count register, which stage-0 resets to zero when it     */
+/* starts.  These are meaningless when power management is compiled in,       */
+/* since idling also slows down the count register.                           */
+/*----------------------------------------------------------------------------*/
+struct Tux64BootExecKernelArgumentsTiming {
+   Tux64UInt32 version;
+   Tux64UInt32 stage0_end;
+   Tux64UInt32 stage1_start;
+   struct Tux64BootExecKernelArgumentsTimingFile files [TUX64_BOOT_EXEC_KERNEL_ARGUMENTS_TIMING_FILES];
+   Tux64UInt32 kernel_start;
+};
+
+/*----------------------------------------------------------------------------*/
+/* The pixel format of a framebuffer handed off to the kernel.                */
+/*                                                                            */
+/* TUX64_BOOT_EXEC_KERNEL_FRAMEBUFFER_FORMAT_NONE - No framebuffer was handed */
+/*    off, so the kernel has to set up video output itself.                   */
+/*                                                                            */
+/* TUX64_BOOT_EXEC_KERNEL_FRAMEBUFFER_FORMAT_RGBA5551 - 16-bit pixels, with 5 */
+/*    bits each for red, green and blue, and 1 bit for alpha.                 */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootExecKernelFramebufferFormat {
+   TUX64_BOOT_EXEC_KERNEL_FRAMEBUFFER_FORMAT_NONE     = 0u,
+   TUX64_BOOT_EXEC_KERNEL_FRAMEBUFFER_FORMAT_RGBA5551 = 1u
+};
+
+/*----------------------------------------------------------------------------*/
+/* A framebuffer which is still being displayed when the kernel starts.       */
+/* 'stride' is the number of bytes between the start of each row.  'format'   */
+/* is one of the values in enum Tux64BootExecKernelFramebufferFormat.         */
+/*----------------------------------------------------------------------------*/
+struct Tux64BootExecKernelArgumentsFramebuffer {
+   Tux64UInt32 address;
+   Tux64UInt32 width;
+   Tux64UInt32 height;
+   Tux64UInt32 stride;
+   Tux64UInt32 format;
+};
+
 /*----------------------------------------------------------------------------*/
 /* Boot arguments passed to the kernel.  Each primitive must be stored in the */
-/* big-endian format.                                                         */
+/* big-endian format.  The first 'memory_map_entries' entries in 'memory_map' */
+/* cover all of memory, sorted by address, without any gaps or overlap.       */
 /*----------------------------------------------------------------------------*/
 struct Tux64BootExecKernelArguments {
    Tux64UInt32 initramfs_address;
    Tux64UInt32 initramfs_bytes;
    Tux64UInt32 command_line_address;
    Tux64UInt32 total_memory;
+   Tux64UInt32 memory_map_entries;
+   struct Tux64BootExecKernelArgumentsMemoryRegion memory_map [TUX64_BOOT_EXEC_KERNEL_ARGUMENTS_MEMORY_MAP_ENTRIES];
+   struct Tux64BootExecKernelArgumentsTiming timing;
+   struct Tux64BootExecKernelArgumentsFramebuffer framebuffer;
 };
 
 /*----------------------------------------------------------------------------*/
-/* Initializes the kernel arguments struct.                                   */
+/* Hands off a framebuffer to the kernel, which must keep being displayed     */
+/* until the kernel starts.  The framebuffer is reserved in the memory map,   */
+/* so this must be called after                                               */
+/* tux64_boot_exec_kernel_arguments_initialize().                             */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_exec_kernel_arguments_framebuffer(
+   Tux64UInt32 address,
+   Tux64UInt32 width,
+   Tux64UInt32 height,
+   Tux64UInt32 stride,
+   enum Tux64BootExecKernelFramebufferFormat format
+);
+
+/*----------------------------------------------------------------------------*/
+/* Initializes the boot timings, clearing every file's timings.  This must be */
+/* called before any other timings are recorded.                              */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_exec_kernel_timing_initialize(
+   Tux64UInt32 stage0_end,
+   Tux64UInt32 stage1_start
+);
+
+/*----------------------------------------------------------------------------*/
+/* Records when 'file' started loading, and when it finished loading and      */
+/* being verified.                                                            */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_exec_kernel_timing_file(
+   enum Tux64BootExecKernelTimingFile file,
+   Tux64UInt32 start,
+   Tux64UInt32 end
+);
+
+/*----------------------------------------------------------------------------*/
+/* Initializes the kernel arguments struct, including the memory map.  The    */
+/* kernel, initramfs and command line must already be allocated in            */
+/* tux64_boot_load_allocations.  No framebuffer is handed off by default.     */
 /*----------------------------------------------------------------------------*/
 void
 tux64_boot_exec_kernel_arguments_initialize(
@@ -34,10 +188,26 @@ tux64_boot_exec_kernel_arguments_initialize(
    Tux64UInt32 total_memory
 );
 
+/*----------------------------------------------------------------------------*/
+/* Moves each kernel segment from its packed location to its final location   */
+/* and zero-initializes the remainder of each segment, assuming the kernel    */
+/* image was loaded at 'load_address'.  This must be called once the kernel   */
+/* image is fully loaded and before executing the kernel, as this is also     */
+/* where the instruction cache is invalidated for the kernel.  This clobbers  */
+/* RSP IMEM, and the RSP DMA engine must be available to queue a DMA          */
+/* transfer.                                                                  */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_exec_kernel_segments_place(
+   Tux64UInt32 load_address
+);
+
 /*----------------------------------------------------------------------------*/
 /* Starts the linux kernel given by the entrypoint.  Assumes interrupts are   */
-/* disabled, the VI and AI are stopped, and there are no ongoing RSP, PI, or  */
-/* SI DMA transfers.  Kernel arguments must first be initialized using        */
+/* disabled, the AI is stopped, and there are no ongoing RSP, PI, or SI DMA   */
+/* transfers.  The VI may still be displaying the framebuffer passed to       */
+/* tux64_boot_exec_kernel_arguments_framebuffer(), but must otherwise be      */
+/* stopped.  Kernel arguments must first be initialized using                 */
 /* tux64_boot_exec_kernel_arguments_initialize() before executing.            */
 /*----------------------------------------------------------------------------*/
 void
@@ -25,6 +25,11 @@ tux64_boot_flag_delay(void) {
       return TUX64_BOOLEAN_FALSE;
    }
 
+   /* there's nothing on-screen to give time to read. */
+   if (tux64_boot_flag_headless() == TUX64_BOOLEAN_TRUE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
    return (tux64_boot_header_flag_no_delay() == TUX64_BOOLEAN_FALSE);
 }
 
@@ -36,3 +41,39 @@ tux64_boot_flag_memory_display(void) {
 
    return (tux64_boot_header_flag_memory_display() == TUX64_BOOLEAN_TRUE);
 }
+
+Tux64Boolean
+tux64_boot_flag_pi_timing(void) {
+   if (!TUX64_BOOT_CONFIG_PI_TIMING) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return (tux64_boot_header_flag_pi_timing() == TUX64_BOOLEAN_TRUE);
+}
+
+Tux64Boolean
+tux64_boot_flag_pi_timing_probe(void) {
+   if (tux64_boot_flag_pi_timing() == TUX64_BOOLEAN_FALSE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return (tux64_boot_header_flag_pi_timing_probe() == TUX64_BOOLEAN_TRUE);
+}
+
+Tux64Boolean
+tux64_boot_flag_stats_display(void) {
+   if (!TUX64_BOOT_CONFIG_STATS_DISPLAY) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return (tux64_boot_header_flag_stats_display() == TUX64_BOOLEAN_TRUE);
+}
+
+Tux64Boolean
+tux64_boot_flag_headless(void) {
+   if (!TUX64_BOOT_CONFIG_HEADLESS) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return (tux64_boot_header_flag_headless() == TUX64_BOOLEAN_TRUE);
+}
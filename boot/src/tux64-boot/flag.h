@@ -21,6 +21,14 @@ Tux64Boolean
 tux64_boot_flag_delay(void);
 Tux64Boolean
 tux64_boot_flag_memory_display(void);
+Tux64Boolean
+tux64_boot_flag_pi_timing(void);
+Tux64Boolean
+tux64_boot_flag_pi_timing_probe(void);
+Tux64Boolean
+tux64_boot_flag_stats_display(void);
+Tux64Boolean
+tux64_boot_flag_headless(void);
 
 /*----------------------------------------------------------------------------*/
 #endif /* _TUX64_BOOT_FLAG_H */
@@ -42,6 +42,31 @@ tux64_boot_header_flag_no_delay(void) {
    return tux64_boot_header_flag(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_NO_DELAY);
 }
 
+Tux64Boolean
+tux64_boot_header_flag_pi_timing(void) {
+   return tux64_boot_header_flag(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING);
+}
+
+Tux64Boolean
+tux64_boot_header_flag_pi_timing_probe(void) {
+   return tux64_boot_header_flag(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING_PROBE);
+}
+
+Tux64Boolean
+tux64_boot_header_flag_stats_display(void) {
+   return tux64_boot_header_flag(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_STATS_DISPLAY);
+}
+
+Tux64Boolean
+tux64_boot_header_flag_headless(void) {
+   return tux64_boot_header_flag(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_HEADLESS);
+}
+
+const struct Tux64PlatformMipsN64BootHeaderPiTiming *
+tux64_boot_header_pi_timing(void) {
+   return &tux64_boot_header.data.pi_timing;
+}
+
 const struct Tux64PlatformMipsN64BootHeaderFile *
 tux64_boot_header_file_bootloader_stage2(void) {
    return &tux64_boot_header.data.files.bootloader.stage2;
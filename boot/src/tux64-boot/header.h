@@ -22,6 +22,20 @@ Tux64Boolean
 tux64_boot_header_flag_memory_display(void);
 Tux64Boolean
 tux64_boot_header_flag_no_delay(void);
+Tux64Boolean
+tux64_boot_header_flag_pi_timing(void);
+Tux64Boolean
+tux64_boot_header_flag_pi_timing_probe(void);
+Tux64Boolean
+tux64_boot_header_flag_stats_display(void);
+Tux64Boolean
+tux64_boot_header_flag_headless(void);
+
+/*----------------------------------------------------------------------------*/
+/* Gets the PI domain 1 timings to apply before loading boot files.           */
+/*----------------------------------------------------------------------------*/
+const struct Tux64PlatformMipsN64BootHeaderPiTiming *
+tux64_boot_header_pi_timing(void);
 
 /*----------------------------------------------------------------------------*/
 /* Gets the information of various boot files.                                */
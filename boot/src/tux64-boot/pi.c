@@ -80,3 +80,33 @@ tux64_boot_pi_dma_wait_idle(void) {
    return status;
 }
 
+
+void
+tux64_boot_pi_timing_dom1_read(
+   struct Tux64PlatformMipsN64BootHeaderPiTiming * timing
+) {
+   volatile struct Tux64PlatformMipsN64MmioRegistersPiBsdDom * dom1;
+
+   dom1 = &tux64_platform_mips_n64_mmio_registers_pi.bsd_dom[0];
+
+   timing->lat = (Tux64UInt8)dom1->lat;
+   timing->pwd = (Tux64UInt8)dom1->pwd;
+   timing->pgs = (Tux64UInt8)dom1->pgs;
+   timing->rls = (Tux64UInt8)dom1->rls;
+   return;
+}
+
+void
+tux64_boot_pi_timing_dom1_write(
+   const struct Tux64PlatformMipsN64BootHeaderPiTiming * timing
+) {
+   volatile struct Tux64PlatformMipsN64MmioRegistersPiBsdDom * dom1;
+
+   dom1 = &tux64_platform_mips_n64_mmio_registers_pi.bsd_dom[0];
+
+   dom1->lat = (Tux64UInt32)timing->lat;
+   dom1->pwd = (Tux64UInt32)timing->pwd;
+   dom1->pgs = (Tux64UInt32)timing->pgs;
+   dom1->rls = (Tux64UInt32)timing->rls;
+   return;
+}
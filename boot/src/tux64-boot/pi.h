@@ -12,6 +12,7 @@
 
 #include "tux64-boot/tux64-boot.h"
 #include <tux64/platform/mips/n64/pi.h>
+#include <tux64/platform/mips/n64/boot.h>
 
 /*----------------------------------------------------------------------------*/
 /* Describes a PI DMA transfer operation.                                     */
@@ -71,6 +72,24 @@ tux64_boot_pi_dma_status(void);
 enum Tux64BootPiDmaStatus
 tux64_boot_pi_dma_wait_idle(void);
 
+/*----------------------------------------------------------------------------*/
+/* Reads the current PI domain 1 bus timings.                                 */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_pi_timing_dom1_read(
+   struct Tux64PlatformMipsN64BootHeaderPiTiming * timing
+);
+
+/*----------------------------------------------------------------------------*/
+/* Sets the PI domain 1 bus timings.  The PI Bus must not be in the middle of */
+/* either an ongoing DMA transfer or memory-mapped read or write when this    */
+/* function is called.                                                        */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_pi_timing_dom1_write(
+   const struct Tux64PlatformMipsN64BootHeaderPiTiming * timing
+);
+
 /*----------------------------------------------------------------------------*/
 #endif /* _TUX64_BOOT_PI_H */
 
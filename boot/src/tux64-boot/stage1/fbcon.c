@@ -22,10 +22,12 @@
 
 /*----------------------------------------------------------------------------*/
 /* okay, here's how this works.  on boot, we have a compressed representation */
-/* of the font map stored in ROM.  this is a 64-character bitmap stream with  */
-/* 8x4 fixed-width characters.  when decompressed, this comes out to exactly  */
-/* 4KiB, which fits neatly into RSP IMEM.  this allows us to render text very */
-/* efficiently with a stream of RSP DMA operations.                           */
+/* of the font map stored in ROM.  this is an 80-character bitmap stream with */
+/* 8x4 fixed-width characters.  when decompressed, the first 64 characters    */
+/* come out to exactly 4KiB, which fits neatly into RSP IMEM.  the rest are   */
+/* stored at the start of RSP DMEM, which nothing else uses after stage-0.    */
+/* this allows us to render text very efficiently with a stream of RSP DMA    */
+/* operations.                                                                */
 /*                                                                            */
 /* when decompressing, each bit in the compressed data corresponds to a pixel */
 /* for each character.  this gives us 2-color characters which are then       */
@@ -63,6 +65,9 @@
 #define TUX64_BOOT_STAGE1_FBCON_CHARACTERS_COLUMNS_BYTES \
    (TUX64_BOOT_STAGE1_FBCON_CHARACTERS_COLUMNS)
 
+#define TUX64_BOOT_STAGE1_FBCON_FONTMAP_BYTES_IMEM 4096u
+#define TUX64_BOOT_STAGE1_FBCON_FONTMAP_BYTES_DMEM 1024u
+
 static const Tux64UInt8
 tux64_boot_stage1_fbcon_fontmap_compressed [] = {
    TUX64_BOOT_STAGE1_FONTMAP_BIN
@@ -71,7 +76,12 @@ tux64_boot_stage1_fbcon_fontmap_compressed [] = {
 /* 16-bit entries so each pixel can be written at once.  also aligned for use */
 /* with RSP DMA */
 static Tux64BootStage1VideoPixel
-tux64_boot_stage1_fbcon_fontmap [4096u / sizeof(Tux64BootStage1VideoPixel)]
+tux64_boot_stage1_fbcon_fontmap [
+   (
+      TUX64_BOOT_STAGE1_FBCON_FONTMAP_BYTES_IMEM +
+      TUX64_BOOT_STAGE1_FBCON_FONTMAP_BYTES_DMEM
+   ) / sizeof(Tux64BootStage1VideoPixel)
+]
 __attribute__((aligned(8u)));
 
 struct Tux64BootStage1FbconCharacterMapLine {
@@ -254,9 +264,15 @@ tux64_boot_stage1_fbcon_character_encode(
    if (character == '.') {
       return TUX64_LITERAL_UINT8(63u);
    }
-   if (character == ' ') {
+   if (character == '/') {
       return TUX64_LITERAL_UINT8(64u);
    }
+   if (character == ':') {
+      return TUX64_LITERAL_UINT8(65u);
+   }
+   if (character == ' ') {
+      return TUX64_LITERAL_UINT8(66u);
+   }
 
    TUX64_UNREACHABLE;
 }
@@ -337,6 +353,23 @@ tux64_boot_stage1_fbcon_fontmap_decompress(
    return;
 }
 
+static void
+tux64_boot_stage1_fbcon_fontmap_load_dmem(void) {
+   struct Tux64BootRspDmaTransfer transfer;
+
+   /* unlike IMEM, nobody else touches the start of DMEM, so the characters */
+   /* stored there only need to be loaded once. */
+   transfer.addr_rsp_mem   = TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_PHYSICAL_RSP_DMEM);
+   transfer.addr_rdram     = (Tux64UInt32)(Tux64UIntPtr)tux64_boot_stage1_fbcon_fontmap + TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_FBCON_FONTMAP_BYTES_IMEM);
+   transfer.row_bytes_copy = TUX64_LITERAL_UINT16(TUX64_BOOT_STAGE1_FBCON_FONTMAP_BYTES_DMEM - 1u);
+   transfer.row_bytes_skip = TUX64_LITERAL_UINT16(0u);
+   transfer.row_count      = TUX64_LITERAL_UINT8(0u);
+
+   tux64_boot_rsp_dma_wait_queue();
+   tux64_boot_rsp_dma_start(&transfer, TUX64_BOOT_RSP_DMA_DESTINATION_RSP_MEMORY);
+   return;
+}
+
 void
 tux64_boot_stage1_fbcon_initialize(
    Tux64BootStage1VideoPixel color_foreground,
@@ -346,6 +379,7 @@ tux64_boot_stage1_fbcon_initialize(
       color_foreground,
       color_background
    );
+   tux64_boot_stage1_fbcon_fontmap_load_dmem();
 
    tux64_boot_stage1_fbcon_character_map_initialize(
       &tux64_boot_stage1_fbcon_character_map
@@ -374,10 +408,11 @@ tux64_boot_stage1_fbcon_render(void) {
    addr_base_framebuffer   = (Tux64UInt32)(Tux64UIntPtr)tux64_boot_stage1_video_render_target_get();
 
    /* first start off by loading the font map into RSP IMEM, split into 2 */
-   /* rows because we can't store 4KiB in 11 bits */
+   /* rows because we can't store 4KiB in 11 bits.  the characters in DMEM */
+   /* were already loaded on initialization. */
    transfer.addr_rsp_mem   = addr_base_rsp_imem;
    transfer.addr_rdram     = (Tux64UInt32)(Tux64UIntPtr)tux64_boot_stage1_fbcon_fontmap;
-   transfer.row_bytes_copy = TUX64_LITERAL_UINT16((sizeof(tux64_boot_stage1_fbcon_fontmap) / 2u) - 1u);
+   transfer.row_bytes_copy = TUX64_LITERAL_UINT16((TUX64_BOOT_STAGE1_FBCON_FONTMAP_BYTES_IMEM / 2u) - 1u);
    transfer.row_bytes_skip = TUX64_LITERAL_UINT16(0u);
    transfer.row_count      = TUX64_LITERAL_UINT8(1u);
    tux64_boot_rsp_dma_start(&transfer, TUX64_BOOT_RSP_DMA_DESTINATION_RSP_MEMORY);
@@ -419,6 +454,8 @@ tux64_boot_stage1_fbcon_render(void) {
             goto skip_rendering;
          }
 
+         /* characters past the end of IMEM wrap around to the start of DMEM, */
+         /* since the RSP DMA address register ignores the upper bits. */
          offset_rsp_imem = character * TUX64_LITERAL_UINT32(
             TUX64_BOOT_STAGE1_FBCON_CHARACTER_PIXELS_HORIZONTAL *
             TUX64_BOOT_STAGE1_FBCON_CHARACTER_PIXELS_VERTICAL *
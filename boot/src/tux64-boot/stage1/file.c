@@ -24,6 +24,7 @@ tux64_boot_stage1_file_load_initialize(
    context->iter_addr_cart    = file->addr_cart;
    context->iter_addr_rdram   = load_address;
    context->bytes_remaining   = file->length;
+   context->pending_bytes     = TUX64_LITERAL_UINT32(0u);
 
    if (tux64_boot_flag_checksum() == TUX64_BOOLEAN_TRUE) {
       context->checksum_expected.uint = tux64_endian_convert_uint32(file->checksum, TUX64_ENDIAN_FORMAT_BIG);
@@ -33,32 +34,46 @@ tux64_boot_stage1_file_load_initialize(
    return;
 }
 
-static enum Tux64BootStage1FileLoadPollStatus
-tux64_boot_stage1_file_load_block(
-   struct Tux64BootStage1FileLoadContext * context,
-   Tux64UInt32 block_size
+static void
+tux64_boot_stage1_file_load_block_start(
+   struct Tux64BootStage1FileLoadContext * context
 ) {
    struct Tux64BootPiDmaTransfer pi_dma_transfer;
-   enum Tux64BootPiDmaStatus pi_status;
-   Tux64UInt32 addr_rdram;
+   Tux64UInt32 block_size;
 
-   addr_rdram = context->iter_addr_rdram;
+   if (context->bytes_remaining >= TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE)) {
+      block_size = TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE);
+   } else {
+      block_size = context->bytes_remaining;
+   }
 
    pi_dma_transfer.addr_pibus = context->iter_addr_cart;
-   pi_dma_transfer.addr_rdram = addr_rdram;
+   pi_dma_transfer.addr_rdram = context->iter_addr_rdram;
    pi_dma_transfer.bytes      = block_size - TUX64_LITERAL_UINT32(1u);
    tux64_boot_pi_dma_start(&pi_dma_transfer, TUX64_BOOT_PI_DMA_DESTINATION_RDRAM);
 
-   context->iter_addr_cart  += block_size;
-   context->iter_addr_rdram += block_size;
-   context->bytes_remaining -= block_size;
+   context->pending_addr_rdram   = context->iter_addr_rdram;
+   context->pending_bytes        = block_size;
+   context->iter_addr_cart      += block_size;
+   context->iter_addr_rdram     += block_size;
+   context->bytes_remaining     -= block_size;
+   return;
+}
+
+static enum Tux64BootStage1FileLoadPollStatus
+tux64_boot_stage1_file_load_block_wait(
+   Tux64UInt32 addr_rdram,
+   Tux64UInt32 block_size
+) {
+   enum Tux64BootPiDmaStatus pi_status;
 
    pi_status = tux64_boot_pi_dma_wait_idle();
 
-   /* invalidate both instruction and data cache since we may be loading */
-   /* executables, which have both code and data.  make sure to invalidate */
-   /* after the DMA transfer to prevent unrelated caches to load garbage. */
-   tux64_boot_cache_invalidate(
+   /* only the data cache needs to be invalidated here, since the kernel's */
+   /* instruction cache lines are invalidated all at once right before it's */
+   /* started.  make sure to invalidate after the DMA transfer to prevent */
+   /* unrelated caches to load garbage. */
+   tux64_boot_cache_invalidate_data(
       (const void *)(Tux64UIntPtr)addr_rdram,
       block_size
    );
@@ -67,14 +82,6 @@ tux64_boot_stage1_file_load_block(
       return TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_IO_ERROR;
    }
 
-   if (tux64_boot_flag_checksum() == TUX64_BOOLEAN_TRUE) {
-      tux64_checksum_fletcher_64_32.digest(
-         &context->checksum_context,
-         (const Tux64UInt8 *)(Tux64UIntPtr)addr_rdram,
-         block_size
-      );
-   }
-
    return TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_COMPLETE;
 }
 
@@ -101,30 +108,47 @@ tux64_boot_stage1_file_load_finalize(
    return TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_COMPLETE;
 }
 
-#define TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE\
-   (4u * 1024u) /* 4KiB */
-
 struct Tux64BootStage1FileLoadPollResult
 tux64_boot_stage1_file_load_poll(
    struct Tux64BootStage1FileLoadContext * context
 ) {
    struct Tux64BootStage1FileLoadPollResult result;
+   Tux64UInt32 addr_rdram;
    Tux64UInt32 block_size;
 
-   if (context->bytes_remaining >= TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE)) {
-      block_size = TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE);
-   } else {
-      block_size = context->bytes_remaining;
-   }
+   /* the block started by the previous poll is finished here, and the next */
+   /* block is started before checksumming it.  that way, the PI is always */
+   /* busy while the CPU checksums, instead of one waiting on the other. */
+   addr_rdram  = context->pending_addr_rdram;
+   block_size  = context->pending_bytes;
 
    result.bytes = block_size;
 
-   result.status = tux64_boot_stage1_file_load_block(context, block_size);
-   if (result.status != TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_COMPLETE) {
-      return result;
+   if (block_size != TUX64_LITERAL_UINT32(0u)) {
+      result.status = tux64_boot_stage1_file_load_block_wait(addr_rdram, block_size);
+      if (result.status != TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_COMPLETE) {
+         return result;
+      }
    }
 
    if (context->bytes_remaining != TUX64_LITERAL_UINT32(0u)) {
+      tux64_boot_stage1_file_load_block_start(context);
+   } else {
+      context->pending_bytes = TUX64_LITERAL_UINT32(0u);
+   }
+
+   if (
+      block_size != TUX64_LITERAL_UINT32(0u) &&
+      tux64_boot_flag_checksum() == TUX64_BOOLEAN_TRUE
+   ) {
+      tux64_checksum_fletcher_64_32.digest(
+         &context->checksum_context,
+         (const Tux64UInt8 *)(Tux64UIntPtr)addr_rdram,
+         block_size
+      );
+   }
+
+   if (context->pending_bytes != TUX64_LITERAL_UINT32(0u)) {
       result.status = TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_BUSY;
       return result;
    }
@@ -14,6 +14,10 @@
 #include <tux64/platform/mips/n64/pi.h>
 #include <tux64/platform/mips/n64/boot.h>
 
+/* the most bytes a single call to tux64_boot_stage1_file_load_poll() loads. */
+#define TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE\
+   (4u * 1024u) /* 4KiB */
+
 enum Tux64BootStage1FileLoadPollStatus {
    TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_BUSY,
    TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_COMPLETE,
@@ -30,12 +34,17 @@ struct Tux64BootStage1FileLoadPollResult {
 };
 
 /*----------------------------------------------------------------------------*/
-/* Stores information about an ongoing file transfer.                         */
+/* Stores information about an ongoing file transfer.  'bytes_remaining'      */
+/* counts the bytes which haven't started transferring yet, while the block   */
+/* at 'pending_addr_rdram' is still being transferred and hasn't been         */
+/* checksummed.                                                               */
 /*----------------------------------------------------------------------------*/
 struct Tux64BootStage1FileLoadContext {
    Tux64PlatformMipsN64PiBusAddress iter_addr_cart;
    Tux64UInt32 iter_addr_rdram;
    Tux64UInt32 bytes_remaining;
+   Tux64UInt32 pending_addr_rdram;
+   Tux64UInt32 pending_bytes;
    union Tux64Int32 checksum_expected;
    struct Tux64ChecksumContext checksum_context;
 };
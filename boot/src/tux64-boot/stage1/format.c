@@ -263,6 +263,146 @@ tux64_boot_stage1_format_percentage(
    return;
 }
 
+/* where each field starts within the statistics buffer, and how many */
+/* characters wide it is. */
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_SPEED_INDEX          0u
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_SPEED_CHARACTERS     6u
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_REMAINING_INDEX      12u
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_REMAINING_CHARACTERS 6u
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_ETA_INDEX            31u
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_ETA_CHARACTERS       5u
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_LAG_INDEX            42u
+#define TUX64_BOOT_STAGE1_FORMAT_STATS_LAG_CHARACTERS       5u
+
+static void
+tux64_boot_stage1_format_fixed_point(
+   Tux64BootStage1FbconLabel label,
+   Tux64UInt8 idx_base,
+   Tux64UInt8 characters,
+   Tux64UInt8 decimals,
+   Tux64UInt32 value,
+   Tux64UInt32 maximum
+) {
+   Tux64UInt8 i;
+
+   if (value > maximum) {
+      value = maximum;
+   }
+
+   i = idx_base + characters;
+
+   if (decimals != TUX64_LITERAL_UINT8(0u)) {
+      do {
+         i--;
+         tux64_boot_stage1_fbcon_label_character_set(
+            label,
+            i,
+            tux64_boot_stage1_format_digit_base10((Tux64UInt8)(value % TUX64_LITERAL_UINT32(10u)))
+         );
+
+         value = value / TUX64_LITERAL_UINT32(10u);
+         decimals--;
+      } while (decimals != TUX64_LITERAL_UINT8(0u));
+
+      i--;
+      tux64_boot_stage1_fbcon_label_character_set(
+         label,
+         i,
+         tux64_boot_stage1_fbcon_character_encode('.')
+      );
+   }
+
+   /* same as the percentage, we always format at least one whole digit. */
+   do {
+      i--;
+      tux64_boot_stage1_fbcon_label_character_set(
+         label,
+         i,
+         tux64_boot_stage1_format_digit_base10((Tux64UInt8)(value % TUX64_LITERAL_UINT32(10u)))
+      );
+
+      value = value / TUX64_LITERAL_UINT32(10u);
+   } while (value != TUX64_LITERAL_UINT32(0u));
+
+   while (i != idx_base) {
+      i--;
+      tux64_boot_stage1_fbcon_label_character_set(
+         label,
+         i,
+         tux64_boot_stage1_fbcon_character_encode(' ')
+      );
+   }
+
+   return;
+}
+
+void
+tux64_boot_stage1_format_stats(
+   Tux64BootStage1FbconLabel label,
+   const struct Tux64BootStage1FormatStats * stats
+) {
+   Tux64UInt8 capacity;
+   Tux64UInt8 idx_base;
+   Tux64UInt32 speed;
+   Tux64UInt32 remaining;
+   Tux64UInt32 eta;
+
+   capacity = tux64_boot_stage1_fbcon_label_capacity_get(label);
+
+   idx_base = capacity - TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_BUFFER_CHARACTERS_STATS);
+
+   tux64_boot_stage1_fbcon_label_copy(
+      label,
+      idx_base,
+      &tux64_boot_stage1_strings_format_stats_static
+   );
+
+   /* sizes are in hundredths of a mebibyte, and the ETA is in tenths of a */
+   /* second.  until we know the speed, we show the largest ETA we can. */
+   speed       = (Tux64UInt32)(((Tux64UInt64)stats->bytes_per_second * TUX64_LITERAL_UINT64(100u)) >> TUX64_LITERAL_UINT8(20u));
+   remaining   = (Tux64UInt32)(((Tux64UInt64)stats->bytes_remaining * TUX64_LITERAL_UINT64(100u)) >> TUX64_LITERAL_UINT8(20u));
+   if (stats->bytes_per_second == TUX64_LITERAL_UINT32(0u)) {
+      eta = TUX64_UINT32_MAX;
+   } else {
+      eta = (Tux64UInt32)(((Tux64UInt64)stats->bytes_remaining * TUX64_LITERAL_UINT64(10u)) / (Tux64UInt64)stats->bytes_per_second);
+   }
+
+   tux64_boot_stage1_format_fixed_point(
+      label,
+      idx_base + TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_SPEED_INDEX),
+      TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_SPEED_CHARACTERS),
+      TUX64_LITERAL_UINT8(2u),
+      speed,
+      TUX64_LITERAL_UINT32(99999u)
+   );
+   tux64_boot_stage1_format_fixed_point(
+      label,
+      idx_base + TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_REMAINING_INDEX),
+      TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_REMAINING_CHARACTERS),
+      TUX64_LITERAL_UINT8(2u),
+      remaining,
+      TUX64_LITERAL_UINT32(99999u)
+   );
+   tux64_boot_stage1_format_fixed_point(
+      label,
+      idx_base + TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_ETA_INDEX),
+      TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_ETA_CHARACTERS),
+      TUX64_LITERAL_UINT8(1u),
+      eta,
+      TUX64_LITERAL_UINT32(9999u)
+   );
+   tux64_boot_stage1_format_fixed_point(
+      label,
+      idx_base + TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_LAG_INDEX),
+      TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_STATS_LAG_CHARACTERS),
+      TUX64_LITERAL_UINT8(0u),
+      stats->frames_missed,
+      TUX64_LITERAL_UINT32(99999u)
+   );
+
+   return;
+}
+
 static void
 tux64_boot_stage1_format_prefix(
    Tux64BootStage1FbconLabel label,
@@ -77,6 +77,29 @@ tux64_boot_stage1_format_percentage(
    Tux64BootStage1FbconLabel label
 );
 
+#define TUX64_BOOT_STAGE1_FORMAT_BUFFER_CHARACTERS_STATS \
+   TUX64_STRING_CHARACTERS("XXX.XXMiB/s XXX.XXMiB left ETA XXX.Xs lag XXXXX")
+
+/* the load speed of the file being loaded, how much of it is left to load, */
+/* and the total number of lag frames so far. */
+struct Tux64BootStage1FormatStats {
+   Tux64UInt32 bytes_per_second;
+   Tux64UInt32 bytes_remaining;
+   Tux64UInt32 frames_missed;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Formats load statistics at the end of a text label, estimating the time    */
+/* remaining from the load speed.  Values too large to fit are clamped.       */
+/* Requires TUX64_BOOT_STAGE1_FORMAT_BUFFER_CHARACTERS_STATS number of free   */
+/* characters at the end to format correctly.                                 */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_stage1_format_stats(
+   Tux64BootStage1FbconLabel label,
+   const struct Tux64BootStage1FormatStats * stats
+);
+
 #define TUX64_BOOT_STAGE1_FORMAT_BUFFER_CHARACTERS_ERROR \
    TUX64_STRING_CHARACTERS("%ERROR% ")
 
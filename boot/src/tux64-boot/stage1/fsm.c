@@ -21,12 +21,12 @@
 #include "tux64-boot/flag.h"
 #include "tux64-boot/stage1/status.h"
 #include "tux64-boot/stage1/memory.h"
-#include "tux64-boot/stage1/preempt.h"
 #include "tux64-boot/stage1/video.h"
 #include "tux64-boot/stage1/interrupt.h"
 #include "tux64-boot/stage1/fbcon.h"
 #include "tux64-boot/stage1/strings.h"
 #include "tux64-boot/stage1/format.h"
+#include "tux64-boot/stage1/pi-timing.h"
 
 #define TUX64_BOOT_STAGE1_FSM_STATE_DECLARATION(identifier) \
    static void identifier (struct Tux64BootStage1Fsm *)
@@ -165,34 +165,36 @@ tux64_boot_stage1_fsm_allocate_kernel(
    Tux64UInt32 kernel_address;
    Tux64UInt32 kernel_bytes;
    struct Tux64BootLoadAllocationsFile * kernel_allocation;
-   Tux64Boolean result;
 
    /* the kernel is a special case because it's the only boot file which has */
    /* to be loaded at a specific address.  the rest of the boot files can be */
-   /* loaded anywhere. */
+   /* loaded anywhere.  we also reserve all memory used by the kernel, not */
+   /* just the packed image, since segments are moved and zero-initialized */
+   /* in-place before booting. */
 
    kernel_file       = tux64_boot_header_file_kernel();
    kernel_address    = kernel_file->addr_load;
-   kernel_bytes      = kernel_file->image.file.length;
+   kernel_bytes      = kernel_file->image.memory;
 
    kernel_allocation = &tux64_boot_load_allocations.required.kernel;
-   result            = TUX64_BOOLEAN_FALSE;
 
-   if (tux64_boot_stage1_memory_stage1_alloc_inplace(kernel_address, kernel_bytes) == TUX64_BOOLEAN_TRUE) {
-      result = TUX64_BOOLEAN_TRUE;
-
-      load_info->status = tux64_bitwise_flags_set_uint8(
-         load_info->status,
-         TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_KERNEL)
-      );
-   }
-
-   if (tux64_boot_stage1_memory_stage2_alloc_inplace(kernel_address, kernel_bytes) == TUX64_BOOLEAN_TRUE) {
-      result = TUX64_BOOLEAN_TRUE;
+   switch (tux64_boot_stage1_memory_alloc_inplace(kernel_address, kernel_bytes)) {
+      case TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1:
+         load_info->status = tux64_bitwise_flags_set_uint8(
+            load_info->status,
+            TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_KERNEL)
+         );
+         break;
+      case TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE2:
+         break;
+      case TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_NO_MEMORY:
+         return TUX64_BOOLEAN_FALSE;
+      default:
+         TUX64_UNREACHABLE;
    }
 
    kernel_allocation->address = kernel_address;
-   return result;
+   return TUX64_BOOLEAN_TRUE;
 }
 
 static Tux64Boolean
@@ -203,25 +205,17 @@ tux64_boot_stage1_fsm_allocate(
    Tux64UInt32 bytes,
    Tux64UInt32 alignment
 ) {
-   Tux64UInt32 address_stage1;
-   Tux64UInt32 address_stage2;
-
-   /* TODO: this will break if we load stage1 -> stage2 -> stage1 due to the */
-   /* heaps desynchronizing. */
-   address_stage1 = tux64_boot_stage1_memory_stage1_alloc(bytes, alignment);
-   address_stage2 = tux64_boot_stage1_memory_stage2_alloc(bytes, alignment);
-
-   if (address_stage1 != TUX64_LITERAL_UINT32(0u)) {
-      load_info->status = tux64_bitwise_flags_set_uint8(load_info->status, status_flag);
-      allocation->address = address_stage1;
-      return TUX64_BOOLEAN_TRUE;
-   }
-   if (address_stage2 != TUX64_LITERAL_UINT32(0u)) {
-      allocation->address = address_stage2;
-      return TUX64_BOOLEAN_TRUE;
+   switch (tux64_boot_stage1_memory_alloc(bytes, alignment, &allocation->address)) {
+      case TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1:
+         load_info->status = tux64_bitwise_flags_set_uint8(load_info->status, status_flag);
+         return TUX64_BOOLEAN_TRUE;
+      case TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE2:
+         return TUX64_BOOLEAN_TRUE;
+      case TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_NO_MEMORY:
+         return TUX64_BOOLEAN_FALSE;
+      default:
+         TUX64_UNREACHABLE;
    }
-
-   return TUX64_BOOLEAN_FALSE;
 }
 
 static Tux64Boolean
@@ -311,12 +305,168 @@ tux64_boot_stage1_fsm_allocate_boot_files(
    return TUX64_BOOLEAN_TRUE;
 }
 
+static Tux64Boolean
+tux64_boot_stage1_fsm_file_loadable(
+   const struct Tux64BootStage1Fsm * fsm,
+   Tux64UInt32 load_address,
+   Tux64BootLoadStatus status_flag
+) {
+   return (
+      load_address != TUX64_LITERAL_UINT32(0u) &&
+      tux64_bitwise_flags_check_one_uint8(fsm->globals.load_info.status, status_flag) == TUX64_BOOLEAN_TRUE
+   );
+}
+
+static void
+tux64_boot_stage1_fsm_queue_file_optional(
+   struct Tux64BootStage1Fsm * fsm,
+   const struct Tux64PlatformMipsN64BootHeaderFile * file,
+   Tux64UInt32 load_address,
+   Tux64BootLoadStatus status_flag
+) {
+   if (tux64_boot_stage1_fsm_file_loadable(fsm, load_address, status_flag) == TUX64_BOOLEAN_FALSE) {
+      return;
+   }
+
+   (void)tux64_boot_stage1_load_queue_push(&fsm->globals.load_queue.queue, file, load_address);
+   return;
+}
+
+static Tux64Boolean
+tux64_boot_stage1_fsm_requires_stage2(
+   const struct Tux64BootStage1Fsm * fsm
+) {
+   return fsm->globals.load_info.status != TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_CONCURRENT_WITH_STAGE1);
+}
+
+static void
+tux64_boot_stage1_fsm_queue_boot_files(
+   struct Tux64BootStage1Fsm * fsm
+) {
+   const struct Tux64PlatformMipsN64BootHeaderFile * stage2;
+
+   /* this has to queue the exact same files in the exact same order as the */
+   /* load file transitions present them in. */
+   tux64_boot_stage1_fsm_queue_file_optional(
+      fsm,
+      &tux64_boot_header_file_kernel()->image.file,
+      tux64_boot_load_allocations.required.kernel.address,
+      TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_KERNEL)
+   );
+   tux64_boot_stage1_fsm_queue_file_optional(
+      fsm,
+      tux64_boot_header_file_initramfs(),
+      tux64_boot_load_allocations.optional.initramfs.address,
+      TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_INITRAMFS)
+   );
+   tux64_boot_stage1_fsm_queue_file_optional(
+      fsm,
+      tux64_boot_header_file_command_line(),
+      tux64_boot_load_allocations.optional.command_line.address,
+      TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_COMMAND_LINE)
+   );
+
+   if (tux64_boot_stage1_fsm_requires_stage2(fsm) == TUX64_BOOLEAN_FALSE) {
+      return;
+   }
+
+   stage2 = tux64_boot_header_file_bootloader_stage2();
+
+   if (
+      TUX64_BOOT_CONFIG_DEBUG &&
+      stage2->length > TUX64_LITERAL_UINT32(TUX64_BOOT_LAYOUT_STAGE2_LOAD_BYTES_MAXIMUM)
+   ) {
+      tux64_boot_halt();
+      TUX64_UNREACHABLE;
+   }
+
+   (void)tux64_boot_stage1_load_queue_push(
+      &fsm->globals.load_queue.queue,
+      stage2,
+      (Tux64UInt32)(Tux64UIntPtr)tux64_boot_stage1_file_stage2
+   );
+   return;
+}
+
+/* the COP0 count register increments every other CPU cycle. */
+#define TUX64_BOOT_STAGE1_FSM_THROUGHPUT_TICKS_PER_SECOND\
+   (93750000u / 2u)
+
+static Tux64UInt32
+tux64_boot_stage1_fsm_throughput_bytes_per_second(
+   Tux64UInt32 bytes,
+   Tux64UInt32 ticks
+) {
+   return (Tux64UInt32)(
+      ((Tux64UInt64)bytes * TUX64_LITERAL_UINT64(TUX64_BOOT_STAGE1_FSM_THROUGHPUT_TICKS_PER_SECOND)) /
+      (Tux64UInt64)ticks
+   );
+}
+
+static Tux64Boolean
+tux64_boot_stage1_fsm_stats_display(void) {
+   /* see tux64_boot_stage1_fsm_display_throughput() for why we can't show */
+   /* any of this with power management. */
+   if (TUX64_BOOT_CONFIG_POWER_MANAGEMENT) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   /* nobody would ever see it, and it's not free to keep updated. */
+   if (tux64_boot_flag_headless() == TUX64_BOOLEAN_TRUE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return tux64_boot_flag_stats_display();
+}
+
+static void
+tux64_boot_stage1_fsm_stats_initialize(
+   struct Tux64BootStage1Fsm * fsm
+) {
+   fsm->globals.stats.label = tux64_boot_stage1_fbcon_label_allocate(
+      TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_FORMAT_BUFFER_CHARACTERS_STATS)
+   );
+   return;
+}
+
+static void
+tux64_boot_stage1_fsm_stats_update(
+   struct Tux64BootStage1Fsm * fsm,
+   Tux64UInt8 entry,
+   Tux64UInt32 bytes_loaded,
+   Tux64UInt32 bytes_total
+) {
+   const struct Tux64BootStage1LoadQueue * queue;
+   struct Tux64BootStage1FormatStats stats;
+   Tux64UInt32 ticks;
+
+   queue = &fsm->globals.load_queue.queue;
+
+   ticks = tux64_boot_stage1_load_queue_entry_ticks(queue, entry);
+   if (ticks == TUX64_LITERAL_UINT32(0u)) {
+      stats.bytes_per_second = TUX64_LITERAL_UINT32(0u);
+   } else {
+      stats.bytes_per_second = tux64_boot_stage1_fsm_throughput_bytes_per_second(bytes_loaded, ticks);
+   }
+
+   stats.bytes_remaining   = bytes_total - bytes_loaded;
+   stats.frames_missed     = tux64_boot_stage1_video_vblanks_missed();
+
+   tux64_boot_stage1_format_stats(fsm->globals.stats.label, &stats);
+   return;
+}
+
 TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_start) {
    if (tux64_boot_stage1_fsm_allocate_boot_files(&fsm->globals.load_info) == TUX64_BOOLEAN_FALSE) {
       tux64_boot_stage1_fsm_halt(fsm, &tux64_boot_stage1_strings_error_no_memory);
       return;
    }
 
+   /* shown above the files, since it's updated for whichever one is loading */
+   if (tux64_boot_stage1_fsm_stats_display() == TUX64_BOOLEAN_TRUE) {
+      tux64_boot_stage1_fsm_stats_initialize(fsm);
+   }
+
    /* we set this early so, in the event of loading stage-2, this is already */
    /* initialized.  thus, we don't have to include this code in stage-2. */
    tux64_boot_exec_kernel_arguments_initialize(
@@ -326,6 +476,10 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_sta
       tux64_boot_stage1_memory_total()
    );
 
+   /* everything from here on out only presents the queue's progress, so the */
+   /* PI stays busy even while messages are shown or during delays. */
+   tux64_boot_stage1_fsm_queue_boot_files(fsm);
+
    /* directly called to avoid unnecessary extra delay */
    tux64_boot_stage1_fsm_transition_load_file_kernel(fsm);
    return;
@@ -335,8 +489,8 @@ static void
 tux64_boot_stage1_fsm_transition_load_file(
    struct Tux64BootStage1Fsm * fsm,
    const struct Tux64PlatformMipsN64BootHeaderFile * file,
-   Tux64UInt32 load_address,
    const struct Tux64BootStage1FbconText * name,
+   enum Tux64BootExecKernelTimingFile timing,
    Tux64BootStage1FsmPfnTransition transition_next
 ) {
    struct Tux64BootStage1FsmMemoryLoadFile * mem;
@@ -345,11 +499,11 @@ tux64_boot_stage1_fsm_transition_load_file(
 
    mem = &fsm->memory.load_file;
 
-   tux64_boot_stage1_file_load_initialize(
-      &mem->file_load_context,
-      file,
-      load_address
-   );
+   /* the file was already queued when we started, so all we do here is */
+   /* follow along with it. */
+   mem->entry           = fsm->globals.load_queue.entry_next++;
+   mem->timing          = timing;
+   mem->bytes_presented = TUX64_LITERAL_UINT32(0u);
 
    tux64_boot_stage1_format_percentage_initialize(
       &mem->percentage_progress,
@@ -377,13 +531,11 @@ tux64_boot_stage1_fsm_transition_load_file_optional(
    const struct Tux64PlatformMipsN64BootHeaderFile * file,
    Tux64UInt32 load_address,
    const struct Tux64BootStage1FbconText * name,
+   enum Tux64BootExecKernelTimingFile timing,
    Tux64BootStage1FsmPfnTransition transition_next,
    Tux64BootLoadStatus status_flag
 ) {
-   if (
-      load_address == TUX64_LITERAL_UINT32(0u) ||
-      tux64_bitwise_flags_check_one_uint8(fsm->globals.load_info.status, status_flag) == TUX64_BOOLEAN_FALSE
-   ) {
+   if (tux64_boot_stage1_fsm_file_loadable(fsm, load_address, status_flag) == TUX64_BOOLEAN_FALSE) {
       /* call directly since we're already coming from a transition, so we */
       /* don't delay twice. */
       transition_next(fsm);
@@ -393,8 +545,8 @@ tux64_boot_stage1_fsm_transition_load_file_optional(
    tux64_boot_stage1_fsm_transition_load_file(
       fsm,
       file,
-      load_address,
       name,
+      timing,
       transition_next
    );
    return;
@@ -412,6 +564,7 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_loa
       &kernel->image.file,
       tux64_boot_load_allocations.required.kernel.address,
       &tux64_boot_stage1_strings_file_kernel,
+      TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_KERNEL,
       tux64_boot_stage1_fsm_transition_load_file_initramfs,
       TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_KERNEL)
    );
@@ -430,6 +583,7 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_loa
       initramfs,
       tux64_boot_load_allocations.optional.initramfs.address,
       &tux64_boot_stage1_strings_file_initramfs,
+      TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_INITRAMFS,
       tux64_boot_stage1_fsm_transition_load_file_command_line,
       TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_INITRAMFS)
    );
@@ -446,7 +600,7 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_loa
 
    /* if we have everything loadable from stage-1, we can boot the kernel */
    /* directly.  otherwise, we need the stage-2 loader. */
-   if (fsm->globals.load_info.status == TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_CONCURRENT_WITH_STAGE1)) {
+   if (tux64_boot_stage1_fsm_requires_stage2(fsm) == TUX64_BOOLEAN_FALSE) {
       transition_next = tux64_boot_stage1_fsm_transition_boot_kernel;
    } else {
       transition_next = tux64_boot_stage1_fsm_transition_load_file_stage2;
@@ -457,6 +611,7 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_loa
       command_line,
       tux64_boot_load_allocations.optional.command_line.address,
       &tux64_boot_stage1_strings_file_command_line,
+      TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_COMMAND_LINE,
       transition_next,
       TUX64_LITERAL_UINT8(TUX64_BOOT_LOAD_STATUS_COMMAND_LINE)
    );
@@ -470,19 +625,11 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_loa
 
    stage2 = tux64_boot_header_file_bootloader_stage2();
 
-   if (
-      TUX64_BOOT_CONFIG_DEBUG &&
-      stage2->length > TUX64_LITERAL_UINT32(TUX64_BOOT_LAYOUT_STAGE2_LOAD_BYTES_MAXIMUM)
-   ) {
-      tux64_boot_halt();
-      TUX64_UNREACHABLE;
-   }
-
    tux64_boot_stage1_fsm_transition_load_file(
       fsm,
       stage2,
-      (Tux64UInt32)(Tux64UIntPtr)tux64_boot_stage1_file_stage2,
       &tux64_boot_stage1_strings_file_bootloader_stage2,
+      TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_STAGE2,
       tux64_boot_stage1_fsm_transition_boot_stage2
    );
    return;
@@ -490,43 +637,59 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_loa
 
 TUX64_BOOT_STAGE1_FSM_STATE_DEFINITION(tux64_boot_stage1_fsm_state_load_file) {
    struct Tux64BootStage1FsmMemoryLoadFile * mem;
-   struct Tux64BootStage1FileLoadPollResult poll_result;
+   const struct Tux64BootStage1LoadQueue * queue;
+   Tux64UInt32 bytes_loaded;
 
    mem = &fsm->memory.load_file;
+   queue = &fsm->globals.load_queue.queue;
 
-   do {
-      poll_result = tux64_boot_stage1_file_load_poll(&mem->file_load_context);
-      tux64_boot_stage1_format_percentage_accumulate(
-         &mem->percentage_progress,
-         poll_result.bytes
-      );
+   bytes_loaded = tux64_boot_stage1_load_queue_entry_bytes(queue, mem->entry);
+   tux64_boot_stage1_format_percentage_accumulate(
+      &mem->percentage_progress,
+      bytes_loaded - mem->bytes_presented
+   );
+   mem->bytes_presented = bytes_loaded;
 
-      if (poll_result.status != TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_BUSY) {
-         break;
-      }
-   } while (tux64_boot_stage1_preempt_yield() == TUX64_BOOLEAN_FALSE);
-   
    tux64_boot_stage1_format_percentage(
       &mem->percentage_progress,
       mem->label_percentage_progress
    );
 
-   switch (poll_result.status) {
-      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_BUSY:
+   if (tux64_boot_stage1_fsm_stats_display() == TUX64_BOOLEAN_TRUE) {
+      tux64_boot_stage1_fsm_stats_update(
+         fsm,
+         mem->entry,
+         bytes_loaded,
+         mem->percentage_progress.maximum
+      );
+   }
+
+   if (tux64_boot_stage1_load_queue_entry_completed(queue, mem->entry) == TUX64_BOOLEAN_TRUE) {
+      tux64_boot_exec_kernel_timing_file(
+         mem->timing,
+         tux64_boot_stage1_load_queue_entry_timestamp_start(queue, mem->entry),
+         tux64_boot_stage1_load_queue_entry_timestamp_end(queue, mem->entry)
+      );
+      tux64_boot_stage1_fsm_transition(fsm, mem->transition_next);
+      return;
+   }
+
+   /* since files are loaded in order, a failure always belongs to the first */
+   /* entry which isn't completed, which is the one we're presenting. */
+   switch (queue->status) {
+      case TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BUSY:
          break;
 
-      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_COMPLETE:
-         tux64_boot_stage1_fsm_transition(fsm, mem->transition_next);
-         return;
-      
-      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_IO_ERROR:
+      case TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IO_ERROR:
          tux64_boot_stage1_fsm_halt(fsm, &tux64_boot_stage1_strings_error_io);
          return;
 
-      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_BAD_CHECKSUM:
+      case TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BAD_CHECKSUM:
          tux64_boot_stage1_fsm_halt(fsm, &tux64_boot_stage1_strings_error_checksum);
          return;
 
+      case TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IDLE:
+      case TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_OVERLAY:
       default:
          TUX64_UNREACHABLE;
    }
@@ -534,7 +697,39 @@ TUX64_BOOT_STAGE1_FSM_STATE_DEFINITION(tux64_boot_stage1_fsm_state_load_file) {
    return;
 }
 
+static void
+tux64_boot_stage1_fsm_display_throughput(
+   const struct Tux64BootStage1LoadQueueThroughput * throughput
+) {
+   Tux64BootStage1FbconLabel label;
+   Tux64UInt32 bytes_per_second;
+
+   /* entering idle with power management enabled slows down the CPU clock, */
+   /* which also slows down the count register, so the results would be */
+   /* garbage.  this also assumes the N64's CPU clock, so the iQue will */
+   /* report a higher value than reality. */
+   if (TUX64_BOOT_CONFIG_POWER_MANAGEMENT) {
+      return;
+   }
+   if (tux64_boot_flag_memory_display() == TUX64_BOOLEAN_FALSE) {
+      return;
+   }
+   if (throughput->ticks == TUX64_LITERAL_UINT32(0u)) {
+      return;
+   }
+
+   bytes_per_second = tux64_boot_stage1_fsm_throughput_bytes_per_second(
+      throughput->bytes,
+      throughput->ticks
+   );
+
+   label = tux64_boot_stage1_fbcon_label_push(&tux64_boot_stage1_strings_load_throughput);
+   tux64_boot_stage1_format_mib(label, bytes_per_second);
+   return;
+}
+
 TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_boot_kernel) {
+   tux64_boot_stage1_fsm_display_throughput(&fsm->globals.load_queue.queue.throughput);
    (void)tux64_boot_stage1_fbcon_label_push(&tux64_boot_stage1_strings_boot_kernel);
    
    /* for the same reason as we have in tux64_boot_stage1_fsm_halt(), we need */
@@ -557,6 +752,7 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_boo
 }
 
 TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_boot_stage2) {
+   tux64_boot_stage1_fsm_display_throughput(&fsm->globals.load_queue.queue.throughput);
    (void)tux64_boot_stage1_fbcon_label_push(&tux64_boot_stage1_strings_boot_stage2);
 
    /* same comments as above. */
@@ -577,21 +773,61 @@ TUX64_BOOT_STAGE1_FSM_TRANSITION_DEFINITION(tux64_boot_stage1_fsm_transition_boo
 }
 
 static void
-tux64_boot_stage1_fsm_reset_hardware(void) {
+tux64_boot_stage1_fsm_reset_hardware(
+   Tux64Boolean display_output
+) {
    /* since we're coming from either the start of a new frame or after */
    /* loading a file, no DMA engines should be active.  thus, all we need to */
    /* do is disable video output and disable interrupts. */
-   tux64_boot_stage1_video_display_output(TUX64_BOOLEAN_FALSE);
+   if (display_output == TUX64_BOOLEAN_FALSE) {
+      tux64_boot_stage1_video_display_output(TUX64_BOOLEAN_FALSE);
+   }
+
+   /* the VI keeps running if we're handing off the framebuffer, so make */
+   /* sure it doesn't leave an interrupt behind for the kernel. */
+   tux64_boot_stage1_interrupt_vi_disable();
    tux64_boot_stage1_interrupt_disable();
    return;
 }
 
+static Tux64Boolean
+tux64_boot_stage1_fsm_framebuffer_handoff(void) {
+   const struct Tux64BootStage1VideoFramebuffer * framebuffer;
+
+   /* there's either nothing being displayed, or something was loaded over */
+   /* the framebuffers. */
+   if (tux64_boot_flag_headless() == TUX64_BOOLEAN_TRUE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+   if (tux64_boot_stage1_video_framebuffers_released() == TUX64_BOOLEAN_TRUE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   /* the displayed framebuffer is left exactly as it is, so the kernel's */
+   /* console can carry on from where we left off without reprogramming the */
+   /* VI or allocating its own framebuffer. */
+   framebuffer = tux64_boot_stage1_video_display_target_get();
+   tux64_boot_exec_kernel_arguments_framebuffer(
+      (Tux64UInt32)(Tux64UIntPtr)framebuffer,
+      TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_VIDEO_FRAMEBUFFER_PIXELS_X),
+      TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_VIDEO_FRAMEBUFFER_PIXELS_Y),
+      TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_VIDEO_FRAMEBUFFER_PIXELS_X * sizeof(Tux64BootStage1VideoPixel)),
+      TUX64_BOOT_EXEC_KERNEL_FRAMEBUFFER_FORMAT_RGBA5551
+   );
+
+   return TUX64_BOOLEAN_TRUE;
+}
+
 TUX64_BOOT_STAGE1_FSM_STATE_DEFINITION(tux64_boot_stage1_fsm_state_boot_kernel) {
    const void * entrypoint;
+   Tux64Boolean framebuffer_handoff;
 
    entrypoint = (const void *)tux64_boot_header_file_kernel()->addr_entry;
 
-   tux64_boot_stage1_fsm_reset_hardware();
+   framebuffer_handoff = tux64_boot_stage1_fsm_framebuffer_handoff();
+   tux64_boot_stage1_fsm_reset_hardware(framebuffer_handoff);
+
+   tux64_boot_exec_kernel_segments_place(tux64_boot_load_allocations.required.kernel.address);
 
    /* kernel arguments were initialized when we created our allocations. */
    tux64_boot_exec_kernel(entrypoint);
@@ -601,7 +837,8 @@ TUX64_BOOT_STAGE1_FSM_STATE_DEFINITION(tux64_boot_stage1_fsm_state_boot_kernel)
 }
 
 TUX64_BOOT_STAGE1_FSM_STATE_DEFINITION(tux64_boot_stage1_fsm_state_boot_stage2) {
-   tux64_boot_stage1_fsm_reset_hardware();
+   /* stage-2 may load over the framebuffers, so we never hand them off. */
+   tux64_boot_stage1_fsm_reset_hardware(TUX64_BOOLEAN_FALSE);
    tux64_boot_exec_stage2(fsm->globals.load_info.status);
    TUX64_UNREACHABLE;
 }
@@ -680,6 +917,13 @@ tux64_boot_stage1_fsm_initialize(
 ) {
    tux64_boot_stage1_status_code_write(TUX64_BOOT_STAGE1_STATUS_CODE_MAIN_STATE_START);
 
+   tux64_boot_stage1_load_queue_initialize(
+      &fsm->globals.load_queue.queue,
+      tux64_boot_stage1_memory_overlay_start(),
+      tux64_boot_stage1_memory_overlay_end()
+   );
+   fsm->globals.load_queue.entry_next = TUX64_LITERAL_UINT8(0u);
+
    if (TUX64_BOOT_CONFIG_SPLASH) {
       tux64_boot_stage1_fsm_initialize_splash();
    }
@@ -696,6 +940,22 @@ tux64_boot_stage1_fsm_initialize(
       tux64_boot_stage1_fsm_initialize_checksum();
    }
 
+   /* this has to happen before we start loading any boot files, and since */
+   /* nothing else is using the PI yet, this is the perfect place for it. */
+   switch (tux64_boot_stage1_pi_timing_initialize()) {
+      case TUX64_BOOT_STAGE1_PI_TIMING_STATUS_UNCHANGED:
+      case TUX64_BOOT_STAGE1_PI_TIMING_STATUS_APPLIED:
+         break;
+      case TUX64_BOOT_STAGE1_PI_TIMING_STATUS_PROBE_REDUCED:
+         (void)tux64_boot_stage1_fbcon_label_push(&tux64_boot_stage1_strings_pi_timing_probe_reduced);
+         break;
+      case TUX64_BOOT_STAGE1_PI_TIMING_STATUS_PROBE_FAILED:
+         (void)tux64_boot_stage1_fbcon_label_push(&tux64_boot_stage1_strings_pi_timing_probe_failed);
+         break;
+      default:
+         TUX64_UNREACHABLE;
+   }
+
    tux64_boot_stage1_fsm_transition(fsm, tux64_boot_stage1_fsm_transition_start);
    return;
 }
@@ -704,6 +964,21 @@ void
 tux64_boot_stage1_fsm_execute(
    struct Tux64BootStage1Fsm * fsm
 ) {
+   struct Tux64BootStage1LoadQueue * queue;
+
+   queue = &fsm->globals.load_queue.queue;
+
+   /* load first so the state presents the most recent progress.  errors are */
+   /* picked up by the load file state once it reaches the failed entry. */
+   if (tux64_boot_stage1_load_queue_poll(queue) == TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_OVERLAY) {
+      /* a file is about to load over the framebuffers.  nothing is rendering */
+      /* at this point in the frame, so we can give them up right away and */
+      /* carry on loading with a blank screen. */
+      tux64_boot_stage1_video_framebuffers_release();
+      tux64_boot_stage1_load_queue_overlay_release(queue);
+      (void)tux64_boot_stage1_load_queue_poll(queue);
+   }
+
    fsm->state(fsm);
    return;
 }
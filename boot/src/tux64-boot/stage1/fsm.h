@@ -11,9 +11,10 @@
 
 #include "tux64-boot/tux64-boot.h"
 #include "tux64-boot/load.h"
+#include "tux64-boot/exec.h"
 #include "tux64-boot/stage1/fbcon.h"
 #include "tux64-boot/stage1/format.h"
-#include "tux64-boot/stage1/file.h"
+#include "tux64-boot/stage1/load-queue.h"
 
 struct Tux64BootStage1Fsm;
 
@@ -25,8 +26,12 @@ struct Tux64BootStage1FsmMemoryDelay {
    Tux64UInt32 ticks_remaining;
 };
 
+/* 'bytes_presented' is how much of the load queue entry at index 'entry' was */
+/* loaded as of the last time the label was updated. */
 struct Tux64BootStage1FsmMemoryLoadFile {
-   struct Tux64BootStage1FileLoadContext file_load_context;
+   Tux64UInt8 entry;
+   enum Tux64BootExecKernelTimingFile timing;
+   Tux64UInt32 bytes_presented;
    struct Tux64BootStage1FormatPercentageContext percentage_progress;
    Tux64BootStage1FbconLabel label_percentage_progress;
    Tux64BootStage1FsmPfnTransition transition_next;
@@ -47,8 +52,24 @@ struct Tux64BootStage1FsmGlobalsLoadInfo {
    Tux64BootLoadStatus status;
 };
 
+/* files are loaded in the background as soon as they're queued, and every */
+/* state only presents the queue's progress.  'entry_next' is the index of */
+/* the next entry to be presented. */
+struct Tux64BootStage1FsmGlobalsLoadQueue {
+   struct Tux64BootStage1LoadQueue queue;
+   Tux64UInt8 entry_next;
+};
+
+/* a single label is shared by every file, since there isn't enough room on */
+/* screen to give each file its own. */
+struct Tux64BootStage1FsmGlobalsStats {
+   Tux64BootStage1FbconLabel label;
+};
+
 struct Tux64BootStage1FsmGlobals {
    struct Tux64BootStage1FsmGlobalsLoadInfo load_info;
+   struct Tux64BootStage1FsmGlobalsLoadQueue load_queue;
+   struct Tux64BootStage1FsmGlobalsStats stats;
 };
 
 struct Tux64BootStage1Fsm {
@@ -66,7 +87,8 @@ tux64_boot_stage1_fsm_initialize(
 );
 
 /*----------------------------------------------------------------------------*/
-/* Executes one tick of the finite state machine.                             */
+/* Executes one tick of the finite state machine.  Queued boot files are      */
+/* loaded in the background every tick, regardless of the current state.      */
 /*----------------------------------------------------------------------------*/
 void
 tux64_boot_stage1_fsm_execute(
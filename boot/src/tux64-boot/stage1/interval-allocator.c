@@ -0,0 +1,238 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/stage1/interval-allocator.c - Implementations for a    */
+/*    sorted interval allocator.                                              */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+#include "tux64-boot/stage1/interval-allocator.h"
+
+#include <tux64/math.h>
+#include "tux64-boot/halt.h"
+
+/*----------------------------------------------------------------------------*/
+/* the blocks are stored sorted by their start address.  this lets us find    */
+/* every free region by walking the blocks once, keeping track of the         */
+/* furthest end address seen so far.  the furthest end, and not the previous */
+/* block's end, is needed since deferred and overlaying blocks may overlap    */
+/* other blocks.                                                              */
+/*                                                                            */
+/* We also assume we never allocate more than the maximum number of           */
+/* allocation blocks.  This eliminates some debug checks, at the cost of      */
+/* safety.                                                                    */
+/*----------------------------------------------------------------------------*/
+
+void
+tux64_boot_stage1_interval_allocator_initialize(
+   struct Tux64BootStage1IntervalAllocator * allocator,
+   Tux64UInt32 address_space_start,
+   Tux64UInt32 address_space_end
+) {
+   allocator->address_space_start   = address_space_start;
+   allocator->address_space_end     = address_space_end;
+   allocator->blocks_allocated      = TUX64_LITERAL_UINT8(0u);
+   return;
+}
+
+static Tux64Boolean
+tux64_boot_stage1_interval_allocator_block_is_excluded(
+   const struct Tux64BootStage1IntervalAllocatorBlock * block,
+   enum Tux64BootStage1IntervalAllocatorBlockType type
+) {
+   switch (type) {
+      case TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_NORMAL:
+      case TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_TRANSIENT:
+      case TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAY:
+         return TUX64_BOOLEAN_FALSE;
+
+      case TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAYING:
+         return block->type == TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAY;
+
+      case TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_DEFERRED:
+         return (
+            block->type == TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_TRANSIENT ||
+            block->type == TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAY
+         );
+
+      default:
+         TUX64_UNREACHABLE;
+   }
+}
+
+static void
+tux64_boot_stage1_interval_allocator_insert_block(
+   struct Tux64BootStage1IntervalAllocator * allocator,
+   Tux64UInt32 start,
+   Tux64UInt32 end,
+   enum Tux64BootStage1IntervalAllocatorBlockType type
+) {
+   struct Tux64BootStage1IntervalAllocatorBlock * block;
+   Tux64UInt8 i;
+
+   if (
+      TUX64_BOOT_CONFIG_DEBUG &&
+      allocator->blocks_allocated == TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_MAX_ALLOCATIONS)
+   ) {
+      /* it's easy to accidentally allocate too much, so i think it's a good */
+      /* idea to add a debug-only safety check here. */
+      tux64_boot_halt();
+      TUX64_UNREACHABLE;
+   }
+
+   /* shift every block after the new one up a slot, starting from the end */
+   i = allocator->blocks_allocated;
+   block = &allocator->blocks[i];
+   while (i != TUX64_LITERAL_UINT8(0u) && block[-1].start > start) {
+      block[0] = block[-1];
+
+      i--;
+      block--;
+   }
+
+   block->start   = start;
+   block->end     = end;
+   block->type    = type;
+   allocator->blocks_allocated++;
+   return;
+}
+
+Tux64Boolean
+tux64_boot_stage1_interval_allocator_alloc_inplace(
+   struct Tux64BootStage1IntervalAllocator * allocator,
+   Tux64UInt32 address,
+   Tux64UInt32 bytes,
+   enum Tux64BootStage1IntervalAllocatorBlockType type
+) {
+   Tux64UInt32 ptr_start;
+   Tux64UInt32 ptr_end;
+   Tux64UInt8 i;
+   const struct Tux64BootStage1IntervalAllocatorBlock * block;
+
+   ptr_start   = address;
+   ptr_end     = ptr_start + bytes;
+
+   if (
+      ptr_start < allocator->address_space_start ||
+      ptr_end > allocator->address_space_end
+   ) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   /* since the blocks are sorted, we can stop at the first block which */
+   /* starts after our region ends. */
+   i = allocator->blocks_allocated;
+   block = allocator->blocks;
+   while (i != TUX64_LITERAL_UINT8(0u) && block->start < ptr_end) {
+      if (
+         block->end > ptr_start &&
+         tux64_boot_stage1_interval_allocator_block_is_excluded(block, type) == TUX64_BOOLEAN_FALSE
+      ) {
+         return TUX64_BOOLEAN_FALSE;
+      }
+
+      i--;
+      block++;
+   }
+
+   tux64_boot_stage1_interval_allocator_insert_block(allocator, ptr_start, ptr_end, type);
+   return TUX64_BOOLEAN_TRUE;
+}
+
+static void
+tux64_boot_stage1_interval_allocator_consider_region(
+   Tux64UInt32 region_start,
+   Tux64UInt32 region_end,
+   Tux64UInt32 bytes,
+   Tux64UInt32 alignment,
+   Tux64UInt32 * best_start,
+   Tux64UInt32 * best_bytes
+) {
+   Tux64UInt32 alloc_start;
+   Tux64UInt32 region_bytes;
+
+   if (region_end <= region_start) {
+      return;
+   }
+
+   alloc_start = tux64_math_align_forward_uint32(region_start, alignment);
+   if (alloc_start >= region_end) {
+      return;
+   }
+
+   region_bytes = region_end - alloc_start;
+   if (region_bytes < bytes) {
+      return;
+   }
+
+   if (
+      *best_start == TUX64_LITERAL_UINT32(0u) ||
+      region_bytes < *best_bytes
+   ) {
+      *best_start = alloc_start;
+      *best_bytes = region_bytes;
+   }
+
+   return;
+}
+
+Tux64UInt32
+tux64_boot_stage1_interval_allocator_alloc(
+   struct Tux64BootStage1IntervalAllocator * allocator,
+   Tux64UInt32 bytes,
+   Tux64UInt32 alignment,
+   enum Tux64BootStage1IntervalAllocatorBlockType type
+) {
+   Tux64UInt32 region_start;
+   Tux64UInt32 best_start;
+   Tux64UInt32 best_bytes;
+   Tux64UInt8 i;
+   const struct Tux64BootStage1IntervalAllocatorBlock * block;
+
+   /* we implement this using the best fit algorithm.  a little "wasted" */
+   /* performance is worth optimizing the contiguous free block size. */
+
+   region_start   = allocator->address_space_start;
+   best_start     = TUX64_LITERAL_UINT32(0u);
+   best_bytes     = TUX64_LITERAL_UINT32(0u);
+
+   i = allocator->blocks_allocated;
+   block = allocator->blocks;
+   while (i != TUX64_LITERAL_UINT8(0u)) {
+      if (tux64_boot_stage1_interval_allocator_block_is_excluded(block, type) == TUX64_BOOLEAN_FALSE) {
+         tux64_boot_stage1_interval_allocator_consider_region(
+            region_start,
+            block->start,
+            bytes,
+            alignment,
+            &best_start,
+            &best_bytes
+         );
+
+         if (block->end > region_start) {
+            region_start = block->end;
+         }
+      }
+
+      i--;
+      block++;
+   }
+
+   tux64_boot_stage1_interval_allocator_consider_region(
+      region_start,
+      allocator->address_space_end,
+      bytes,
+      alignment,
+      &best_start,
+      &best_bytes
+   );
+
+   if (best_start == TUX64_LITERAL_UINT32(0u)) {
+      return TUX64_LITERAL_UINT32(0u);
+   }
+
+   tux64_boot_stage1_interval_allocator_insert_block(allocator, best_start, best_start + bytes, type);
+   return best_start;
+}
+
@@ -0,0 +1,110 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/stage1/interval-allocator.h - Header for implementing  */
+/*    a sorted interval allocator.                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef _TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_H
+#define _TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_H
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+
+/* stage-1 itself + framebuffers + kernel + initramfs + command line, with */
+/* room to spare for transient buffers.  this is why we don't implement */
+/* this in tux64-lib. */
+#define TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_MAX_ALLOCATIONS\
+   8u
+
+/*----------------------------------------------------------------------------*/
+/* Describes when a block of memory is in use, which decides which blocks it  */
+/* may overlap.                                                               */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_NORMAL - In use from the   */
+/*    moment it's allocated.  Can't overlap any other block.                  */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_TRANSIENT - In use from    */
+/*    the moment it's allocated, but abandoned before any deferred block is   */
+/*    used.  Can't overlap any other block.                                   */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAY - In use from the  */
+/*    moment it's allocated, but abandoned as soon as an overlaying block     */
+/*    starts being used.  Can't overlap any other block.                      */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAYING - In use from   */
+/*    the moment it's allocated, like a normal block, but it may overlap      */
+/*    overlay blocks.  Can't overlap any other block.                         */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_DEFERRED - Only used after */
+/*    every transient and overlay block has been abandoned, so it may overlap */
+/*    transient and overlay blocks, but no other blocks.                      */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootStage1IntervalAllocatorBlockType {
+   TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_NORMAL,
+   TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_TRANSIENT,
+   TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAY,
+   TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAYING,
+   TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_DEFERRED
+};
+
+struct Tux64BootStage1IntervalAllocatorBlock {
+   Tux64UInt32 start;
+   Tux64UInt32 end;
+   enum Tux64BootStage1IntervalAllocatorBlockType type;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Stores the information to implement an interval allocator.  The blocks     */
+/* are kept sorted by their start address, so the free regions between them   */
+/* can be found in a single pass.                                             */
+/*----------------------------------------------------------------------------*/
+struct Tux64BootStage1IntervalAllocator {
+   Tux64UInt32 address_space_start;
+   Tux64UInt32 address_space_end;
+   struct Tux64BootStage1IntervalAllocatorBlock blocks [TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_MAX_ALLOCATIONS];
+   Tux64UInt8 blocks_allocated;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Initializes an interval allocator.  All allocations will return addresses  */
+/* in the range 'address_space_start' to 'address_space_end'.                 */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_stage1_interval_allocator_initialize(
+   struct Tux64BootStage1IntervalAllocator * allocator,
+   Tux64UInt32 address_space_start,
+   Tux64UInt32 address_space_end
+);
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to allocate a range of memory at a specified address.  Returns    */
+/* whether the allocation succeeded or not.  The given address range must be  */
+/* within the heap's address space.                                           */
+/*----------------------------------------------------------------------------*/
+Tux64Boolean
+tux64_boot_stage1_interval_allocator_alloc_inplace(
+   struct Tux64BootStage1IntervalAllocator * allocator,
+   Tux64UInt32 address,
+   Tux64UInt32 bytes,
+   enum Tux64BootStage1IntervalAllocatorBlockType type
+);
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to allocate a block of memory which satisfies the given size and  */
+/* alignment.  The block is placed in the smallest free region it fits in, to */
+/* keep the largest free regions intact for later allocations.  Returns the   */
+/* pointer to the allocated block upon success, or zero upon failure.         */
+/*----------------------------------------------------------------------------*/
+Tux64UInt32
+tux64_boot_stage1_interval_allocator_alloc(
+   struct Tux64BootStage1IntervalAllocator * allocator,
+   Tux64UInt32 bytes,
+   Tux64UInt32 alignment,
+   enum Tux64BootStage1IntervalAllocatorBlockType type
+);
+
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_H */
+
@@ -0,0 +1,264 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/stage1/load-queue.c - Implementations for the          */
+/*    background file load queue.                                             */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+#include "tux64-boot/stage1/load-queue.h"
+
+#include <tux64/platform/mips/vr4300/cop0.h>
+#include "tux64-boot/halt.h"
+#include "tux64-boot/stage1/preempt.h"
+
+void
+tux64_boot_stage1_load_queue_initialize(
+   struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt32 overlay_start,
+   Tux64UInt32 overlay_end
+) {
+   queue->throughput.bytes    = TUX64_LITERAL_UINT32(0u);
+   queue->throughput.ticks    = TUX64_LITERAL_UINT32(0u);
+   queue->overlay.start       = overlay_start;
+   queue->overlay.end         = overlay_end;
+   queue->status              = TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IDLE;
+   queue->entries_queued      = TUX64_LITERAL_UINT8(0u);
+   queue->entries_completed   = TUX64_LITERAL_UINT8(0u);
+   return;
+}
+
+static void
+tux64_boot_stage1_load_queue_start_entry(
+   struct Tux64BootStage1LoadQueue * queue
+) {
+   struct Tux64BootStage1LoadQueueEntry * entry;
+
+   entry = &queue->entries[queue->entries_completed];
+   entry->timestamp_start = tux64_platform_mips_vr4300_cop0_register_read_count();
+
+   tux64_boot_stage1_file_load_initialize(
+      &queue->file_load_context,
+      entry->file,
+      entry->load_address
+   );
+
+   queue->status = TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BUSY;
+   return;
+}
+
+Tux64UInt8
+tux64_boot_stage1_load_queue_push(
+   struct Tux64BootStage1LoadQueue * queue,
+   const struct Tux64PlatformMipsN64BootHeaderFile * file,
+   Tux64UInt32 load_address
+) {
+   struct Tux64BootStage1LoadQueueEntry * entry;
+   Tux64UInt8 index;
+
+   index = queue->entries_queued;
+
+   if (
+      TUX64_BOOT_CONFIG_DEBUG &&
+      index == TUX64_LITERAL_UINT8(TUX64_BOOT_STAGE1_LOAD_QUEUE_MAX_ENTRIES)
+   ) {
+      tux64_boot_halt();
+      TUX64_UNREACHABLE;
+   }
+
+   entry = &queue->entries[index];
+   entry->file          = file;
+   entry->load_address  = load_address;
+   entry->ticks         = TUX64_LITERAL_UINT32(0u);
+   queue->entries_queued++;
+
+   /* if everything before this was already loaded, nothing will start this */
+   /* entry for us. */
+   if (queue->status == TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IDLE) {
+      tux64_boot_stage1_load_queue_start_entry(queue);
+   }
+
+   return index;
+}
+
+static Tux64Boolean
+tux64_boot_stage1_load_queue_overlay_reached(
+   const struct Tux64BootStage1LoadQueue * queue
+) {
+   const struct Tux64BootStage1FileLoadContext * context;
+   Tux64UInt32 block_start;
+   Tux64UInt32 block_end;
+
+   context = &queue->file_load_context;
+
+   /* the last block is already transferring, so there's nothing left to */
+   /* start which could overlap. */
+   if (context->bytes_remaining == TUX64_LITERAL_UINT32(0u)) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   /* we only need to check the next block, since we check again before */
+   /* every block after it. */
+   block_start = context->iter_addr_rdram;
+   if (context->bytes_remaining >= TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE)) {
+      block_end = block_start + TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_FILE_LOAD_BLOCK_SIZE);
+   } else {
+      block_end = block_start + context->bytes_remaining;
+   }
+
+   return (
+      block_start < queue->overlay.end &&
+      block_end > queue->overlay.start
+   );
+}
+
+/* returns true if there's still more to load */
+static Tux64Boolean
+tux64_boot_stage1_load_queue_poll_block(
+   struct Tux64BootStage1LoadQueue * queue
+) {
+   struct Tux64BootStage1FileLoadPollResult poll_result;
+   Tux64UInt32 ticks_start;
+
+   if (tux64_boot_stage1_load_queue_overlay_reached(queue) == TUX64_BOOLEAN_TRUE) {
+      queue->status = TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_OVERLAY;
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   /* timed per block instead of per poll, since a single poll can finish */
+   /* one file and start on the next. */
+   if (TUX64_BOOT_CONFIG_STATS_DISPLAY) {
+      ticks_start = tux64_platform_mips_vr4300_cop0_register_read_count();
+   }
+
+   poll_result = tux64_boot_stage1_file_load_poll(&queue->file_load_context);
+   queue->throughput.bytes += poll_result.bytes;
+
+   if (TUX64_BOOT_CONFIG_STATS_DISPLAY) {
+      queue->entries[queue->entries_completed].ticks +=
+         tux64_platform_mips_vr4300_cop0_register_read_count() - ticks_start;
+   }
+
+   switch (poll_result.status) {
+      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_BUSY:
+         return TUX64_BOOLEAN_TRUE;
+
+      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_COMPLETE:
+         break;
+
+      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_IO_ERROR:
+         queue->status = TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IO_ERROR;
+         return TUX64_BOOLEAN_FALSE;
+
+      case TUX64_BOOT_STAGE1_FILE_LOAD_POLL_STATUS_BAD_CHECKSUM:
+         queue->status = TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BAD_CHECKSUM;
+         return TUX64_BOOLEAN_FALSE;
+
+      default:
+         TUX64_UNREACHABLE;
+   }
+
+   queue->entries[queue->entries_completed].timestamp_end = tux64_platform_mips_vr4300_cop0_register_read_count();
+   queue->entries_completed++;
+   if (queue->entries_completed == queue->entries_queued) {
+      queue->status = TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IDLE;
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   /* move straight on to the next file so the PI never sits idle. */
+   tux64_boot_stage1_load_queue_start_entry(queue);
+   return TUX64_BOOLEAN_TRUE;
+}
+
+enum Tux64BootStage1LoadQueueStatus
+tux64_boot_stage1_load_queue_poll(
+   struct Tux64BootStage1LoadQueue * queue
+) {
+   Tux64UInt32 ticks_start;
+
+   if (queue->status != TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BUSY) {
+      return queue->status;
+   }
+
+   ticks_start = tux64_platform_mips_vr4300_cop0_register_read_count();
+
+   while (
+      tux64_boot_stage1_load_queue_poll_block(queue) == TUX64_BOOLEAN_TRUE &&
+      tux64_boot_stage1_preempt_yield() == TUX64_BOOLEAN_FALSE
+   ) {}
+
+   /* this wraps around after roughly 90 seconds, but unsigned subtraction */
+   /* makes this work as long as a single frame doesn't take that long. */
+   queue->throughput.ticks += tux64_platform_mips_vr4300_cop0_register_read_count() - ticks_start;
+
+   return queue->status;
+}
+
+void
+tux64_boot_stage1_load_queue_overlay_release(
+   struct Tux64BootStage1LoadQueue * queue
+) {
+   /* no block can start before address zero, so this can never overlap. */
+   queue->overlay.start = TUX64_LITERAL_UINT32(0u);
+   queue->overlay.end   = TUX64_LITERAL_UINT32(0u);
+
+   if (queue->status == TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_OVERLAY) {
+      queue->status = TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BUSY;
+   }
+
+   return;
+}
+
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_bytes(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+) {
+   const struct Tux64PlatformMipsN64BootHeaderFile * file;
+
+   file = queue->entries[index].file;
+
+   if (index < queue->entries_completed) {
+      return file->length;
+   }
+   if (index > queue->entries_completed) {
+      return TUX64_LITERAL_UINT32(0u);
+   }
+
+   /* the block still being transferred doesn't count as loaded yet. */
+   return file->length - queue->file_load_context.bytes_remaining - queue->file_load_context.pending_bytes;
+}
+
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_ticks(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+) {
+   return queue->entries[index].ticks;
+}
+
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_timestamp_start(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+) {
+   return queue->entries[index].timestamp_start;
+}
+
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_timestamp_end(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+) {
+   return queue->entries[index].timestamp_end;
+}
+
+Tux64Boolean
+tux64_boot_stage1_load_queue_entry_completed(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+) {
+   return index < queue->entries_completed;
+}
+
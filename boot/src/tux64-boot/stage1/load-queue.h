@@ -0,0 +1,180 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/stage1/load-queue.h - Header for the background file   */
+/*    load queue.                                                             */
+/*----------------------------------------------------------------------------*/
+
+#ifndef _TUX64_BOOT_STAGE1_LOAD_QUEUE_H
+#define _TUX64_BOOT_STAGE1_LOAD_QUEUE_H
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+#include <tux64/platform/mips/n64/boot.h>
+#include "tux64-boot/stage1/file.h"
+
+/* kernel + initramfs + command line + stage-2 */
+#define TUX64_BOOT_STAGE1_LOAD_QUEUE_MAX_ENTRIES\
+   4u
+
+/*----------------------------------------------------------------------------*/
+/* The state of the load queue as a whole.                                    */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IDLE - Every queued file is loaded.    */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BUSY - Files are still being loaded.   */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_OVERLAY - The next block would load    */
+/*    into the overlay, so loading is paused until                            */
+/*    tux64_boot_stage1_load_queue_overlay_release() is called.               */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IO_ERROR,                              */
+/* TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BAD_CHECKSUM - The file after the last */
+/*    completed entry failed to load, and nothing else will be loaded.        */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootStage1LoadQueueStatus {
+   TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IDLE,
+   TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BUSY,
+   TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_OVERLAY,
+   TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_IO_ERROR,
+   TUX64_BOOT_STAGE1_LOAD_QUEUE_STATUS_BAD_CHECKSUM
+};
+
+struct Tux64BootStage1LoadQueueEntry {
+   const struct Tux64PlatformMipsN64BootHeaderFile * file;
+   Tux64UInt32 load_address;
+
+   /* the number of COP0 count ticks spent loading this entry's blocks, only */
+   /* measured when the statistics display is compiled in. */
+   Tux64UInt32 ticks;
+
+   /* the COP0 count register when this entry started loading, and when it */
+   /* finished loading and being verified. */
+   Tux64UInt32 timestamp_start;
+   Tux64UInt32 timestamp_end;
+};
+
+/* the total number of bytes loaded, and the number of COP0 count ticks spent */
+/* loading them. */
+struct Tux64BootStage1LoadQueueThroughput {
+   Tux64UInt32 bytes;
+   Tux64UInt32 ticks;
+};
+
+/* a range of memory which is still in use, and so can't be loaded into */
+/* until it's released. */
+struct Tux64BootStage1LoadQueueOverlay {
+   Tux64UInt32 start;
+   Tux64UInt32 end;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Stores the files waiting to be loaded, which are loaded one after another  */
+/* in the order they were pushed.                                             */
+/*----------------------------------------------------------------------------*/
+struct Tux64BootStage1LoadQueue {
+   struct Tux64BootStage1LoadQueueEntry entries [TUX64_BOOT_STAGE1_LOAD_QUEUE_MAX_ENTRIES];
+   struct Tux64BootStage1FileLoadContext file_load_context;
+   struct Tux64BootStage1LoadQueueThroughput throughput;
+   struct Tux64BootStage1LoadQueueOverlay overlay;
+   enum Tux64BootStage1LoadQueueStatus status;
+   Tux64UInt8 entries_queued;
+   Tux64UInt8 entries_completed;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Initializes an empty load queue.  Queued files may overlap the memory      */
+/* between 'overlay_start' and 'overlay_end', but loading will pause right    */
+/* before the first block which would overwrite it.                           */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_stage1_load_queue_initialize(
+   struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt32 overlay_start,
+   Tux64UInt32 overlay_end
+);
+
+/*----------------------------------------------------------------------------*/
+/* Pushes a file onto the end of the queue, returning its index.  The same    */
+/* requirements as tux64_boot_stage1_file_load_initialize() apply.  The file  */
+/* is only loaded from inside tux64_boot_stage1_load_queue_poll().            */
+/*----------------------------------------------------------------------------*/
+Tux64UInt8
+tux64_boot_stage1_load_queue_push(
+   struct Tux64BootStage1LoadQueue * queue,
+   const struct Tux64PlatformMipsN64BootHeaderFile * file,
+   Tux64UInt32 load_address
+);
+
+/*----------------------------------------------------------------------------*/
+/* Loads queued files until either preemption is requested, the queue is      */
+/* empty, or a file fails to load.  Returns the status of the queue.  This is */
+/* safe to call even when there's nothing to load.                            */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootStage1LoadQueueStatus
+tux64_boot_stage1_load_queue_poll(
+   struct Tux64BootStage1LoadQueue * queue
+);
+
+/*----------------------------------------------------------------------------*/
+/* Marks the overlay as no longer in use, letting a paused queue continue     */
+/* loading on the next poll.                                                  */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_stage1_load_queue_overlay_release(
+   struct Tux64BootStage1LoadQueue * queue
+);
+
+/*----------------------------------------------------------------------------*/
+/* Returns the number of bytes loaded so far for the entry at 'index'.        */
+/*----------------------------------------------------------------------------*/
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_bytes(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+);
+
+/*----------------------------------------------------------------------------*/
+/* Returns the number of COP0 count ticks spent loading the entry at 'index'  */
+/* so far.  This is always zero unless the statistics display is compiled in. */
+/*----------------------------------------------------------------------------*/
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_ticks(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+);
+
+/*----------------------------------------------------------------------------*/
+/* Returns the value of the COP0 count register when the entry at 'index'     */
+/* started loading.  Only valid once the entry has been started.              */
+/*----------------------------------------------------------------------------*/
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_timestamp_start(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+);
+
+/*----------------------------------------------------------------------------*/
+/* Returns the value of the COP0 count register when the entry at 'index'     */
+/* finished loading and being verified.  Only valid once the entry has been   */
+/* completed.                                                                 */
+/*----------------------------------------------------------------------------*/
+Tux64UInt32
+tux64_boot_stage1_load_queue_entry_timestamp_end(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+);
+
+/*----------------------------------------------------------------------------*/
+/* Returns whether the entry at 'index' has been fully loaded and verified.   */
+/*----------------------------------------------------------------------------*/
+Tux64Boolean
+tux64_boot_stage1_load_queue_entry_completed(
+   const struct Tux64BootStage1LoadQueue * queue,
+   Tux64UInt8 index
+);
+
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_BOOT_STAGE1_LOAD_QUEUE_H */
+
@@ -11,21 +11,30 @@
 
 #include <tux64/platform/mips/n64/memory-map.h>
 #include "tux64-boot/layout.h"
-#include "tux64-boot/stage1/arena-allocator.h"
-
-/* we two seperate heaps so we can perform memory allocations for stage-2     */
-/* ahead of time without including the entire arena allocator in the stage-2  */
-/* binary.  this also lets us better report allocation errors when we have    */
-/* the fbcon loaded.                                                          */
-struct Tux64BootStage1MemoryStatisticsHeap {
-   struct Tux64BootStage1ArenaAllocator stage1;
-   struct Tux64BootStage1ArenaAllocator stage2;
-};
-
+#include "tux64-boot/stage1/interval-allocator.h"
+
+/* all memory after stage-2 is tracked by a single heap, including stage-1    */
+/* itself as a transient block.  memory which doesn't fit around stage-1 is   */
+/* allocated as a deferred block on top of it, to be loaded by stage-2 once   */
+/* stage-1 is gone.  since both stages share the same view of free memory,    */
+/* blocks loaded by stage-1 can never be clobbered by blocks loaded by        */
+/* stage-2, no matter which order they're allocated in.                       */
+/*                                                                            */
+/* the framebuffers get an overlay block at the very end of memory.  on       */
+/* consoles without the expansion pak, they're big enough that the last       */
+/* files can't fit around them.  rather than leaving those files for stage-2, */
+/* stage-1 loads over the framebuffers, and since the overlay is at the end,  */
+/* it's only the final blocks of a file which overlap it.                     */
+/*                                                                            */
+/* nothing is ever freed.  stage-1 and the overlay are abandoned instead, and */
+/* their block types already say which later blocks are allowed to overlap    */
+/* them.                                                                      */
 struct Tux64BootStage1MemoryStatistics {
    Tux64UInt32 total;
    Tux64UInt32 free;
-   struct Tux64BootStage1MemoryStatisticsHeap heap;
+   Tux64UInt32 overlay_start;
+   Tux64UInt32 overlay_end;
+   struct Tux64BootStage1IntervalAllocator heap;
 };
 
 static struct Tux64BootStage1MemoryStatistics
@@ -42,29 +51,34 @@ tux64_boot_stage1_memory_initialize(
    Tux64UInt32 memory_total,
    Tux64UInt32 memory_free
 ) {
-   Tux64UInt32 heap_stage1_start;
-   Tux64UInt32 heap_stage1_end;
-   Tux64UInt32 heap_stage2_start;
-   Tux64UInt32 heap_stage2_end;
-
-   tux64_boot_stage1_memory_statistics.total = memory_total;
-   tux64_boot_stage1_memory_statistics.free = memory_free;
-
-   heap_stage1_start = (Tux64UIntPtr)(Tux64UIntPtr)tux64_boot_stage1_memory_heap_start;
-   heap_stage1_end   = TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_RDRAM_CACHED) + memory_total;
-
-   heap_stage2_start = TUX64_LITERAL_UINT32(TUX64_BOOT_LAYOUT_STAGE2_MEMORY_RESERVED);
-   heap_stage2_end   = TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_RDRAM_CACHED) + memory_total;
-
-   tux64_boot_stage1_arena_allocator_initialize(
-      &tux64_boot_stage1_memory_statistics.heap.stage1,
-      heap_stage1_start,
-      heap_stage1_end
+   Tux64UInt32 heap_start;
+   Tux64UInt32 heap_end;
+   Tux64UInt32 stage1_start;
+   Tux64UInt32 stage1_end;
+
+   tux64_boot_stage1_memory_statistics.total          = memory_total;
+   tux64_boot_stage1_memory_statistics.free           = memory_free;
+   tux64_boot_stage1_memory_statistics.overlay_start  = TUX64_LITERAL_UINT32(0u);
+   tux64_boot_stage1_memory_statistics.overlay_end    = TUX64_LITERAL_UINT32(0u);
+
+   heap_start     = TUX64_LITERAL_UINT32(TUX64_BOOT_LAYOUT_STAGE2_MEMORY_RESERVED);
+   heap_end       = TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_RDRAM_CACHED) + memory_total;
+   stage1_start   = TUX64_LITERAL_UINT32(TUX64_BOOT_LAYOUT_STAGE1_STACK_ADDRESS);
+   stage1_end     = (Tux64UInt32)(Tux64UIntPtr)tux64_boot_stage1_memory_heap_start;
+
+   tux64_boot_stage1_interval_allocator_initialize(
+      &tux64_boot_stage1_memory_statistics.heap,
+      heap_start,
+      heap_end
    );
-   tux64_boot_stage1_arena_allocator_initialize(
-      &tux64_boot_stage1_memory_statistics.heap.stage2,
-      heap_stage2_start,
-      heap_stage2_end
+
+   /* this can't fail, since the heap is empty and stage-1 fits in memory, */
+   /* otherwise we wouldn't be running. */
+   (void)tux64_boot_stage1_interval_allocator_alloc_inplace(
+      &tux64_boot_stage1_memory_statistics.heap,
+      stage1_start,
+      stage1_end - stage1_start,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_TRANSIENT
    );
 
    return;
@@ -80,67 +94,124 @@ tux64_boot_stage1_memory_free(void) {
    return tux64_boot_stage1_memory_statistics.free;
 }
 
-Tux64Boolean
-tux64_boot_stage1_memory_stage1_alloc_inplace(
-   Tux64UInt32 address,
+Tux64UInt32
+tux64_boot_stage1_memory_alloc_overlay(
    Tux64UInt32 bytes
 ) {
-   Tux64Boolean retn;
+   struct Tux64BootStage1MemoryStatistics * stats;
+   Tux64UInt32 address;
+
+   stats = &tux64_boot_stage1_memory_statistics;
 
-   retn = tux64_boot_stage1_arena_allocator_alloc_inplace(
-      &tux64_boot_stage1_memory_statistics.heap.stage1,
+   /* this can't fail, since it's allocated before any boot files and */
+   /* stage-1 is nowhere near the end of memory.  we don't count this against */
+   /* free memory, since it's given back before booting. */
+   address = stats->heap.address_space_end - bytes;
+   (void)tux64_boot_stage1_interval_allocator_alloc_inplace(
+      &stats->heap,
       address,
-      bytes
+      bytes,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAY
    );
 
-   if (retn == TUX64_BOOLEAN_TRUE) {
+   stats->overlay_start = address;
+   stats->overlay_end   = address + bytes;
+   return address;
+}
+
+Tux64UInt32
+tux64_boot_stage1_memory_overlay_start(void) {
+   return tux64_boot_stage1_memory_statistics.overlay_start;
+}
+
+Tux64UInt32
+tux64_boot_stage1_memory_overlay_end(void) {
+   return tux64_boot_stage1_memory_statistics.overlay_end;
+}
+
+enum Tux64BootStage1MemoryAllocStatus
+tux64_boot_stage1_memory_alloc_inplace(
+   Tux64UInt32 address,
+   Tux64UInt32 bytes
+) {
+   if (tux64_boot_stage1_interval_allocator_alloc_inplace(
+      &tux64_boot_stage1_memory_statistics.heap,
+      address,
+      bytes,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_NORMAL
+   ) == TUX64_BOOLEAN_TRUE) {
+      tux64_boot_stage1_memory_statistics.free -= bytes;
+      return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1;
+   }
+
+   /* loading over the overlay blanks the screen early, but that's still */
+   /* much faster than leaving the whole file to stage-2. */
+   if (tux64_boot_stage1_interval_allocator_alloc_inplace(
+      &tux64_boot_stage1_memory_statistics.heap,
+      address,
+      bytes,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAYING
+   ) == TUX64_BOOLEAN_TRUE) {
       tux64_boot_stage1_memory_statistics.free -= bytes;
+      return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1;
+   }
+
+   if (tux64_boot_stage1_interval_allocator_alloc_inplace(
+      &tux64_boot_stage1_memory_statistics.heap,
+      address,
+      bytes,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_DEFERRED
+   ) == TUX64_BOOLEAN_TRUE) {
+      return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE2;
    }
 
-   return retn;
+   return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_NO_MEMORY;
 }
 
-Tux64UInt32
-tux64_boot_stage1_memory_stage1_alloc(
+enum Tux64BootStage1MemoryAllocStatus
+tux64_boot_stage1_memory_alloc(
    Tux64UInt32 bytes,
-   Tux64UInt32 alignment
+   Tux64UInt32 alignment,
+   Tux64UInt32 * address
 ) {
    Tux64UInt32 retn;
 
-   retn = tux64_boot_stage1_arena_allocator_alloc(
-      &tux64_boot_stage1_memory_statistics.heap.stage1,
+   retn = tux64_boot_stage1_interval_allocator_alloc(
+      &tux64_boot_stage1_memory_statistics.heap,
       bytes,
-      alignment
+      alignment,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_NORMAL
    );
-
    if (retn != TUX64_LITERAL_UINT32(0u)) {
       tux64_boot_stage1_memory_statistics.free -= bytes;
+      *address = retn;
+      return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1;
    }
 
-   return retn;
-}
-
-Tux64Boolean
-tux64_boot_stage1_memory_stage2_alloc_inplace(
-   Tux64UInt32 address,
-   Tux64UInt32 bytes
-) {
-   return tux64_boot_stage1_arena_allocator_alloc_inplace(
-      &tux64_boot_stage1_memory_statistics.heap.stage2,
-      address,
-      bytes
+   /* same as above. */
+   retn = tux64_boot_stage1_interval_allocator_alloc(
+      &tux64_boot_stage1_memory_statistics.heap,
+      bytes,
+      alignment,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_OVERLAYING
    );
-}
+   if (retn != TUX64_LITERAL_UINT32(0u)) {
+      tux64_boot_stage1_memory_statistics.free -= bytes;
+      *address = retn;
+      return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1;
+   }
 
-Tux64UInt32
-tux64_boot_stage1_memory_stage2_alloc(
-   Tux64UInt32 bytes,
-   Tux64UInt32 alignment
-) {
-   return tux64_boot_stage1_arena_allocator_alloc(
-      &tux64_boot_stage1_memory_statistics.heap.stage2,
+   retn = tux64_boot_stage1_interval_allocator_alloc(
+      &tux64_boot_stage1_memory_statistics.heap,
       bytes,
-      alignment
+      alignment,
+      TUX64_BOOT_STAGE1_INTERVAL_ALLOCATOR_BLOCK_TYPE_DEFERRED
    );
+   if (retn != TUX64_LITERAL_UINT32(0u)) {
+      *address = retn;
+      return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE2;
+   }
+
+   return TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_NO_MEMORY;
 }
 
@@ -34,47 +34,66 @@ Tux64UInt32
 tux64_boot_stage1_memory_free(void);
 
 /*----------------------------------------------------------------------------*/
-/* Attempts to allocate a range of memory at a specified address from the     */
-/* stage-1 heap.  This follows the same API as                                */
-/* tux64_boot_arena_allocator_alloc_inplace().                                */
+/* Allocates 'bytes' at the very end of memory as an overlay, returning its   */
+/* address.  Boot files loaded by stage-1 may overlap the overlay, so it must */
+/* be given up before they're loaded into it.  This can only be called once,  */
+/* before any boot files are allocated.  'bytes' must be a multiple of 8.     */
 /*----------------------------------------------------------------------------*/
-Tux64Boolean
-tux64_boot_stage1_memory_stage1_alloc_inplace(
-   Tux64UInt32 address,
+Tux64UInt32
+tux64_boot_stage1_memory_alloc_overlay(
    Tux64UInt32 bytes
 );
 
 /*----------------------------------------------------------------------------*/
-/* Attempts to allocate a block of memory which satisfies the given size and  */
-/* alignment from the stage-1 heap.  This follows the same API as             */
-/* tux64_boot_arena_allocator_alloc().                                        */
+/* Queries the address range of the overlay, or an empty range at address     */
+/* zero if it was never allocated.                                            */
 /*----------------------------------------------------------------------------*/
 Tux64UInt32
-tux64_boot_stage1_memory_stage1_alloc(
-   Tux64UInt32 bytes,
-   Tux64UInt32 alignment
-);
+tux64_boot_stage1_memory_overlay_start(void);
+Tux64UInt32
+tux64_boot_stage1_memory_overlay_end(void);
+
+/*----------------------------------------------------------------------------*/
+/* The result of a memory allocation, which also tells us which stage is able */
+/* to load into the allocated memory.                                         */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1 - The memory doesn't overlap  */
+/*    stage-1, so stage-1 can load into it.  It may still overlap the         */
+/*    overlay.                                                                */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE2 - The memory overlaps stage-1 */
+/*    so it can only be loaded into by stage-2.                               */
+/*                                                                            */
+/* TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_NO_MEMORY - There isn't enough free  */
+/*    memory, even after stage-1 is no longer needed.                         */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootStage1MemoryAllocStatus {
+   TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE1,
+   TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_STAGE2,
+   TUX64_BOOT_STAGE1_MEMORY_ALLOC_STATUS_NO_MEMORY
+};
 
 /*----------------------------------------------------------------------------*/
-/* Attempts to allocate a range of memory at a specified address from the     */
-/* stage-2 heap.  This follows the same API as                                */
-/* tux64_boot_arena_allocator_alloc_inplace().                                */
+/* Attempts to allocate a range of memory at a specified address.  Memory     */
+/* which doesn't overlap stage-1 is always preferred.                         */
 /*----------------------------------------------------------------------------*/
-Tux64Boolean
-tux64_boot_stage1_memory_stage2_alloc_inplace(
+enum Tux64BootStage1MemoryAllocStatus
+tux64_boot_stage1_memory_alloc_inplace(
    Tux64UInt32 address,
    Tux64UInt32 bytes
 );
 
 /*----------------------------------------------------------------------------*/
 /* Attempts to allocate a block of memory which satisfies the given size and  */
-/* alignment from the stage-2 heap.  This follows the same API as             */
-/* tux64_boot_arena_allocator_alloc().                                        */
+/* alignment, storing its address in 'address' upon success.  Memory which    */
+/* doesn't overlap stage-1 is always preferred, and the smallest free region  */
+/* which fits is used to keep larger regions free for later allocations.      */
 /*----------------------------------------------------------------------------*/
-Tux64UInt32
-tux64_boot_stage1_memory_stage2_alloc(
+enum Tux64BootStage1MemoryAllocStatus
+tux64_boot_stage1_memory_alloc(
    Tux64UInt32 bytes,
-   Tux64UInt32 alignment
+   Tux64UInt32 alignment,
+   Tux64UInt32 * address
 );
 
 /*----------------------------------------------------------------------------*/
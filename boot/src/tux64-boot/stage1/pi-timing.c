@@ -0,0 +1,160 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/stage1/pi-timing.c - Implementations for applying PI   */
+/*    bus timing profiles.                                                    */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+#include "tux64-boot/stage1/pi-timing.h"
+
+#include <tux64/memory.h>
+#include <tux64/platform/mips/n64/pi.h>
+#include <tux64/platform/mips/n64/boot.h>
+#include "tux64-boot/pi.h"
+#include "tux64-boot/cache.h"
+#include "tux64-boot/flag.h"
+#include "tux64-boot/header.h"
+
+/* we probe the start of the boot header and stage-1 since it's guaranteed to */
+/* exist in every ROM.  1KiB is enough to cross a couple of PI pages with the */
+/* default page size, so we also exercise the PGS and RLS timings. */
+#define TUX64_BOOT_STAGE1_PI_TIMING_PROBE_OFFSET\
+   (0x1000u)
+#define TUX64_BOOT_STAGE1_PI_TIMING_PROBE_BYTES\
+   (1024u)
+
+/* aligned to a data cache line so invalidating it can't discard any */
+/* neighboring data. */
+__attribute__((aligned(16)))
+static Tux64UInt8
+tux64_boot_stage1_pi_timing_probe_buffer_reference[TUX64_BOOT_STAGE1_PI_TIMING_PROBE_BYTES];
+__attribute__((aligned(16)))
+static Tux64UInt8
+tux64_boot_stage1_pi_timing_probe_buffer_test[TUX64_BOOT_STAGE1_PI_TIMING_PROBE_BYTES];
+
+static Tux64Boolean
+tux64_boot_stage1_pi_timing_probe_read(
+   Tux64UInt8 * buffer
+) {
+   struct Tux64BootPiDmaTransfer transfer;
+   enum Tux64BootPiDmaStatus status;
+
+   /* write back any dirty lines first so they can't be evicted on top of */
+   /* the DMA transfer. */
+   tux64_boot_cache_flush_data(
+      buffer,
+      TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_PI_TIMING_PROBE_BYTES)
+   );
+
+   transfer.addr_pibus = tux64_platform_mips_n64_pi_bus_address_dom1_rom(
+      TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_PI_TIMING_PROBE_OFFSET)
+   );
+   transfer.addr_rdram = (Tux64UInt32)(Tux64UIntPtr)buffer;
+   transfer.bytes      = TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_PI_TIMING_PROBE_BYTES - 1u);
+   tux64_boot_pi_dma_start(&transfer, TUX64_BOOT_PI_DMA_DESTINATION_RDRAM);
+
+   status = tux64_boot_pi_dma_wait_idle();
+
+   tux64_boot_cache_invalidate_data(
+      buffer,
+      TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_PI_TIMING_PROBE_BYTES)
+   );
+
+   return (status == TUX64_BOOT_PI_DMA_STATUS_COMPLETED);
+}
+
+static Tux64Boolean
+tux64_boot_stage1_pi_timing_probe_try(
+   const struct Tux64PlatformMipsN64BootHeaderPiTiming * timing
+) {
+   tux64_boot_pi_timing_dom1_write(timing);
+
+   if (tux64_boot_stage1_pi_timing_probe_read(tux64_boot_stage1_pi_timing_probe_buffer_test) == TUX64_BOOLEAN_FALSE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return tux64_memory_compare_with_equal_lengths(
+      tux64_boot_stage1_pi_timing_probe_buffer_reference,
+      tux64_boot_stage1_pi_timing_probe_buffer_test,
+      TUX64_LITERAL_UINT32(TUX64_BOOT_STAGE1_PI_TIMING_PROBE_BYTES)
+   );
+}
+
+/* returns how many profiles are slower than 'timing'.  if 'timing' isn't one */
+/* of the profiles, there's nothing we know to be slower, so this is zero. */
+static Tux64UInt32
+tux64_boot_stage1_pi_timing_probe_slower_profiles(
+   const struct Tux64PlatformMipsN64BootHeaderPiTiming * timing
+) {
+   Tux64UInt32 i;
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILES_COUNT)) {
+      if (tux64_memory_compare_with_equal_lengths(
+         &tux64_platform_mips_n64_boot_pi_timing_profiles[i],
+         timing,
+         TUX64_LITERAL_UINT32(sizeof(*timing))
+      ) == TUX64_BOOLEAN_TRUE) {
+         return i;
+      }
+
+      i++;
+   }
+
+   return TUX64_LITERAL_UINT32(0u);
+}
+
+static enum Tux64BootStage1PiTimingStatus
+tux64_boot_stage1_pi_timing_probe(
+   const struct Tux64PlatformMipsN64BootHeaderPiTiming * timing
+) {
+   struct Tux64PlatformMipsN64BootHeaderPiTiming timing_original;
+   Tux64UInt32 profile;
+
+   tux64_boot_pi_timing_dom1_read(&timing_original);
+
+   /* if we can't even read with the original timings, something is very */
+   /* wrong and we shouldn't make it worse. */
+   if (tux64_boot_stage1_pi_timing_probe_read(tux64_boot_stage1_pi_timing_probe_buffer_reference) == TUX64_BOOLEAN_FALSE) {
+      return TUX64_BOOT_STAGE1_PI_TIMING_STATUS_PROBE_FAILED;
+   }
+
+   if (tux64_boot_stage1_pi_timing_probe_try(timing) == TUX64_BOOLEAN_TRUE) {
+      return TUX64_BOOT_STAGE1_PI_TIMING_STATUS_APPLIED;
+   }
+
+   /* the profiles are ordered from slowest to fastest, so walking down from */
+   /* the selected one keeps the fastest timings which still work. */
+   profile = tux64_boot_stage1_pi_timing_probe_slower_profiles(timing);
+   while (profile != TUX64_LITERAL_UINT32(0u)) {
+      profile--;
+
+      if (tux64_boot_stage1_pi_timing_probe_try(&tux64_platform_mips_n64_boot_pi_timing_profiles[profile]) == TUX64_BOOLEAN_TRUE) {
+         return TUX64_BOOT_STAGE1_PI_TIMING_STATUS_PROBE_REDUCED;
+      }
+   }
+
+   tux64_boot_pi_timing_dom1_write(&timing_original);
+   return TUX64_BOOT_STAGE1_PI_TIMING_STATUS_PROBE_FAILED;
+}
+
+enum Tux64BootStage1PiTimingStatus
+tux64_boot_stage1_pi_timing_initialize(void) {
+   const struct Tux64PlatformMipsN64BootHeaderPiTiming * timing;
+
+   if (tux64_boot_flag_pi_timing() == TUX64_BOOLEAN_FALSE) {
+      return TUX64_BOOT_STAGE1_PI_TIMING_STATUS_UNCHANGED;
+   }
+
+   timing = tux64_boot_header_pi_timing();
+
+   if (tux64_boot_flag_pi_timing_probe() == TUX64_BOOLEAN_TRUE) {
+      return tux64_boot_stage1_pi_timing_probe(timing);
+   }
+
+   tux64_boot_pi_timing_dom1_write(timing);
+   return TUX64_BOOT_STAGE1_PI_TIMING_STATUS_APPLIED;
+}
+
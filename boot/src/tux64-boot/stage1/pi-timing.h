@@ -0,0 +1,35 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* boot/src/tux64-boot/stage1/pi-timing.h - Header for applying PI bus timing */
+/*    profiles from the boot header.                                          */
+/*----------------------------------------------------------------------------*/
+
+#ifndef _TUX64_BOOT_STAGE1_PI_TIMING_H
+#define _TUX64_BOOT_STAGE1_PI_TIMING_H
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-boot/tux64-boot.h"
+
+enum Tux64BootStage1PiTimingStatus {
+   TUX64_BOOT_STAGE1_PI_TIMING_STATUS_UNCHANGED,
+   TUX64_BOOT_STAGE1_PI_TIMING_STATUS_APPLIED,
+   TUX64_BOOT_STAGE1_PI_TIMING_STATUS_PROBE_REDUCED,
+   TUX64_BOOT_STAGE1_PI_TIMING_STATUS_PROBE_FAILED
+};
+
+/*----------------------------------------------------------------------------*/
+/* Applies the PI domain 1 timings stored in the boot header, if enabled.  If */
+/* probing is enabled, a chunk of ROM is read with the current timings, then  */
+/* with the new timings, then with each slower timing profile in turn, and    */
+/* the first timings which read back identically are kept.  If none of them   */
+/* do, the original timings are restored.  The PI must be idle when this is   */
+/* called.                                                                    */
+/*----------------------------------------------------------------------------*/
+enum Tux64BootStage1PiTimingStatus
+tux64_boot_stage1_pi_timing_initialize(void);
+
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_BOOT_STAGE1_PI_TIMING_H */
+
@@ -8,10 +8,13 @@
 #include "tux64-boot/tux64-boot.h"
 #include "tux64-boot/stage1/stage1.h"
 
+#include <tux64/platform/mips/vr4300/cop0.h>
 #include "tux64-boot/initialize.h"
 #include "tux64-boot/ipl2.h"
 #include "tux64-boot/rsp.h"
 #include "tux64-boot/pif.h"
+#include "tux64-boot/flag.h"
+#include "tux64-boot/exec.h"
 #include "tux64-boot/stage1/status.h"
 #include "tux64-boot/stage1/memory.h"
 #include "tux64-boot/stage1/interrupt.h"
@@ -65,6 +68,28 @@ tux64_boot_stage1_choose_video_platform(
    return (enum Tux64BootStage1VideoPlatform)video_standard;
 }
 
+static void
+tux64_boot_stage1_render(void) {
+   /* we order all rendering code next to each other not just because it   */
+   /* makes sense, but we can also potentially keep the RSP DMA engine     */
+   /* saturated with work as a previous DMA transfer completes.            */
+   tux64_boot_stage1_video_render_target_clear();
+   tux64_boot_rsp_dma_wait_queue();
+   tux64_boot_stage1_fbcon_render();
+   if (TUX64_BOOT_CONFIG_LOGO) {
+      tux64_boot_rsp_dma_wait_queue();
+      tux64_boot_stage1_logo_render();
+   }
+
+   /* synchronize all RSP DMA operations, otherwise we could end up         */
+   /* swapping buffers in the middle of rendering if the FSM state was      */
+   /* preempted by vblank, thus we swap buffers immediately.  this also     */
+   /* ensures correct synchronization for the start of the next render,     */
+   /* and that nothing is still rendering if the framebuffers are released. */
+   tux64_boot_rsp_dma_wait_idle();
+   return;
+}
+
 /* we store the FSM in a global variable because its state can be huge (think */
 /* DMA buffers).  if we try to store it on the stack, it will overflow 100%   */
 /* and crash our program.  storing in .bss via a global variable doesn't have */
@@ -81,12 +106,20 @@ tux64_boot_stage1_main(
    Tux64UInt8 pif_rom_version,
    Tux64UInt32 memory_total,
    Tux64UInt32 memory_free,
-   Tux64Boolean running_on_ique
+   Tux64Boolean running_on_ique,
+   Tux64UInt32 stage0_end
 ) {
    enum Tux64BootStage1VideoPlatform video_platform;
    struct Tux64BootStage1Palette video_palette;
+   Tux64Boolean headless;
+   Tux64UInt32 stage1_start;
+
+   /* read before anything else, so the gap after stage-0 is all that's */
+   /* measured. */
+   stage1_start = tux64_platform_mips_vr4300_cop0_register_read_count();
 
    tux64_boot_initialize();
+   tux64_boot_exec_kernel_timing_initialize(stage0_end, stage1_start);
 
    tux64_boot_stage1_status_code_write(TUX64_BOOT_STAGE1_STATUS_CODE_BEGIN);
 
@@ -103,16 +136,25 @@ tux64_boot_stage1_main(
       running_on_ique
    );
 
+   headless = tux64_boot_flag_headless();
+
    tux64_boot_stage1_status_code_write(TUX64_BOOT_STAGE1_STATUS_CODE_INITIALIZE_VIDEO);
    tux64_boot_stage1_interrupt_vi_disable();
-   tux64_boot_stage1_video_initialize(
-      video_platform,
-      video_palette.background
-   );
-   tux64_boot_stage1_interrupt_vi_enable();
+   if (headless == TUX64_BOOLEAN_TRUE) {
+      /* the VI interrupt stays masked, so nothing ever preempts loading, and */
+      /* since the framebuffers are never allocated, there's no overlay to */
+      /* pause for either. */
+      tux64_boot_stage1_video_display_output(TUX64_BOOLEAN_FALSE);
+   } else {
+      tux64_boot_stage1_video_initialize(
+         video_platform,
+         video_palette.background
+      );
+      tux64_boot_stage1_interrupt_vi_enable();
 
-   if (TUX64_BOOT_CONFIG_LOGO) {
-      tux64_boot_stage1_logo_initialize(video_palette.background);
+      if (TUX64_BOOT_CONFIG_LOGO) {
+         tux64_boot_stage1_logo_initialize(video_palette.background);
+      }
    }
 
    tux64_boot_stage1_fbcon_initialize(
@@ -134,26 +176,21 @@ tux64_boot_stage1_main(
    tux64_boot_stage1_status_code_write(TUX64_BOOT_STAGE1_STATUS_CODE_PIF_TERMINATE_BOOT);
    tux64_boot_pif_terminate_boot();
 
+   /* with nothing to draw, there's no reason to wait for vblank, so the FSM */
+   /* runs back-to-back until it hands off to the kernel. */
+   while (headless == TUX64_BOOLEAN_TRUE) {
+      tux64_boot_stage1_fsm_execute(&tux64_boot_stage1_fsm);
+   }
+
    while (TUX64_BOOLEAN_TRUE) {
       tux64_boot_stage1_fsm_execute(&tux64_boot_stage1_fsm);
 
-      /* we order all rendering code next to each other not just because   */
-      /* it makes sense, but we can also potentially keep the RSP DMA      */
-      /* engine saturated with work as a previous DMA transfer completes.  */
-      tux64_boot_stage1_video_render_target_clear();
-      tux64_boot_rsp_dma_wait_queue();
-      tux64_boot_stage1_fbcon_render();
-      if (TUX64_BOOT_CONFIG_LOGO) {
-         tux64_boot_rsp_dma_wait_queue();
-         tux64_boot_stage1_logo_render();
+      /* once the framebuffers are released, they're being loaded into, so */
+      /* we keep running frames to pace the FSM without drawing anything.  */
+      if (tux64_boot_stage1_video_framebuffers_released() == TUX64_BOOLEAN_FALSE) {
+         tux64_boot_stage1_render();
       }
 
-      /* synchronize all RSP DMA operations, otherwise we could end up     */
-      /* swapping buffers in the middle of rendering if the FSM state was  */
-      /* preempted by vblank, thus we swap buffers immediately.  this also */
-      /* ensures correct synchronization for the start of the next render. */
-      tux64_boot_rsp_dma_wait_idle();
-
       /* this only works when we take less than one VI to execute, i.e. we */
       /* don't have a lag frame.  our bootloader is so simple, we have     */
       /* full control and can write code that never lags.  that is, the    */
@@ -25,7 +25,8 @@ tux64_boot_stage1_main(
    Tux64UInt8 pif_rom_version,
    Tux64UInt32 memory_total,
    Tux64UInt32 memory_available,
-   Tux64Boolean running_on_ique
+   Tux64Boolean running_on_ique,
+   Tux64UInt32 stage0_end
 )
 __attribute__((noreturn));
 
@@ -18,6 +18,8 @@ tux64_boot_stage1_strings_format_mib_static;
 extern const struct Tux64BootStage1FbconText
 tux64_boot_stage1_strings_format_percentage_static;
 extern const struct Tux64BootStage1FbconText
+tux64_boot_stage1_strings_format_stats_static;
+extern const struct Tux64BootStage1FbconText
 tux64_boot_stage1_strings_format_error;
 extern const struct Tux64BootStage1FbconText
 tux64_boot_stage1_strings_format_loading;
@@ -39,6 +41,12 @@ extern const struct Tux64BootStage1FbconTextLabel
 tux64_boot_stage1_strings_kernel_address_entry;
 extern const struct Tux64BootStage1FbconTextLabel
 tux64_boot_stage1_strings_no_checksum;
+extern const struct Tux64BootStage1FbconTextLabel
+tux64_boot_stage1_strings_pi_timing_probe_failed;
+extern const struct Tux64BootStage1FbconTextLabel
+tux64_boot_stage1_strings_pi_timing_probe_reduced;
+extern const struct Tux64BootStage1FbconTextLabel
+tux64_boot_stage1_strings_load_throughput;
 extern const struct Tux64BootStage1FbconText
 tux64_boot_stage1_strings_file_bootloader_stage2;
 extern const struct Tux64BootStage1FbconText
@@ -14,9 +14,9 @@
 #include <tux64/endian.h>
 #include "tux64-boot/halt.h"
 #include "tux64-boot/sync.h"
-#include "tux64-boot/rsp.h"
-#include "tux64-boot/cache.h"
+#include "tux64-boot/bulk.h"
 #include "tux64-boot/stage1/interrupt.h"
+#include "tux64-boot/stage1/memory.h"
 
 #define TUX64_BOOT_STAGE1_VIDEO_UNKNOWN_CONFIGURATION \
    !( \
@@ -93,11 +93,14 @@
    (0x400u)
 
 struct Tux64BootStage1VideoContext {
-   struct Tux64BootStage1VideoFramebuffer framebuffers [TUX64_BOOT_STAGE1_VIDEO_CONTEXT_FRAMEBUFFERS_COUNT];
-   Tux64UInt64 clear_color_rsp_dma_buffer [0x1000u / sizeof(Tux64UInt64)]
-   __attribute__((aligned(8u))); /* alignment required for RSP DMA */
+   struct Tux64BootStage1VideoFramebuffer * framebuffers;
+   Tux64UInt64 clear_color;
    struct Tux64BootSyncFence vblank_fence;
+   volatile Tux64UInt32 vblanks_triggered;
+   Tux64UInt32 vblanks_ended;
+   Tux64UInt32 vblanks_missed;
    Tux64UInt8 framebuffer_index_displaying;
+   Tux64Boolean framebuffers_released;
 };
 
 static struct Tux64BootStage1VideoContext
@@ -167,37 +170,16 @@ tux64_boot_stage1_video_initialize_context_clear_color(
    Tux64BootStage1VideoPixel clear_color
 ) {
    struct Tux64BootStage1VideoContext * ctx;
-   Tux64UInt64 clear_color_x8b;
-   Tux64UInt64 * iter_dma_buffer;
-   Tux64UInt32 words_remaining;
 
    ctx = &tux64_boot_stage1_video_context;
 
    /* we do this because it's cheaper to loop less times and issue 64-bit */
    /* stores than 2x/4x as many 32-bit/16-bit stores. */
-   clear_color_x8b = tux64_endian_convert_uint64(
+   ctx->clear_color = tux64_endian_convert_uint64(
       tux64_boot_stage1_video_clear_color_get_uint64(clear_color),
       TUX64_ENDIAN_FORMAT_BIG
    );
 
-   /* we now fill the rsp dma buffer 8 bytes at a time with out pixel data. */
-   /* when we later clear the framebuffer, this will be used to fill the */
-   /* entire framebuffer one 4kb chunk at a time. */
-   iter_dma_buffer = ctx->clear_color_rsp_dma_buffer;
-   words_remaining = TUX64_LITERAL_UINT32(sizeof(ctx->clear_color_rsp_dma_buffer));
-   do {
-      *iter_dma_buffer = clear_color_x8b;
-
-      iter_dma_buffer++;
-      words_remaining--;
-   } while (words_remaining != TUX64_LITERAL_UINT32(0u));
-
-   /* and now make sure it's flushed for RSP DMA */
-   tux64_boot_cache_flush_data(
-      ctx->clear_color_rsp_dma_buffer,
-      TUX64_LITERAL_UINT32(sizeof(ctx->clear_color_rsp_dma_buffer))
-   );
-
    return;
 }
 
@@ -207,75 +189,20 @@ tux64_boot_stage1_video_framebuffer_clear(
 ) {
    struct Tux64BootStage1VideoContext * ctx;
    struct Tux64BootStage1VideoFramebuffer * framebuffer;
-   Tux64UInt8 blocks;
-   Tux64UInt16 bytes_remainder;
-   struct Tux64BootRspDmaTransfer rsp_dma_transfer;
 
    ctx         = &tux64_boot_stage1_video_context;
    framebuffer = tux64_boot_stage1_video_framebuffer_get(idx);
 
-   blocks            = TUX64_LITERAL_UINT8(sizeof(framebuffer->pixels) / sizeof(ctx->clear_color_rsp_dma_buffer));
-   bytes_remainder   = TUX64_LITERAL_UINT16(sizeof(framebuffer->pixels) % sizeof(ctx->clear_color_rsp_dma_buffer));
-
-   /* here, we use RSP DMA to efficiently fill the entire framebuffer with a  */
-   /* repeating pattern of pixels.  this is the fastest way to fill any chunk */
-   /* of memory on the N64, and this is a perfect use case.  visually, this   */
-   /* is what we're doing:                                                    */
-   /*                                                                         */
-   /*         [RDRAM]            [RSP DMA TRANSFER]          [RSP IMEM]       */
-   /*                                                                         */
-   /* clear_color_rsp_dma_buffer ----- 4KiB ---->        (uninitialized)      */
-   /* framebuffer[0]             <---- 4KiB -----  clear_color_rsp_dma_buffer */
-   /* framebuffer[1]             <---- 4KiB -----  clear_color_rsp_dma_buffer */
-   /*                                  ...                                    */
-   /* framebuffer[blocks - 1]    <---- 4KiB -----  clear_color_rsp_dma_buffer */
-   /* framebuffer[blocks]        <-- remainder --  clear_color_rsp_dma_buffer */
-   /*                                                                         */
-   /* here, we use a spinlock after each DMA transfer to make this code       */
-   /* synchronous with the RSP.  theoretically, we could use SP interrupts to */
-   /* do this asynchronously, but performance in the main loop isn't an issue */
-   /* here, and this severely complicates our code, so we don't do this.      */
-   /*                                                                         */
-   /* also, the reason we use IMEM and not DMEM is so we preserve boot status */
-   /* codes (if they're enabled).  otherwise, we either sacrifice on transfer */
-   /* size to avoid overwriting the boot status code or we have to write to a */
-   /* different location, which is not ideal since now multiple boot stages   */
-   /* have multiple status code addresses.  this is also why we're not        */
-   /* uploading microcode to the RSP, as that could interfere with boot       */
-   /* status codes for the same reason.                                       */
-
-   /* initialize transfer values which will be shared across transfers.  note */
-   /* that we have to split this as 2 "rows", since we can't store 4KiB */
-   /* inside a 12-bit integer. */
-   rsp_dma_transfer.addr_rsp_mem    = TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_MEMORY_MAP_ADDRESS_PHYSICAL_RSP_IMEM);
-   rsp_dma_transfer.row_bytes_copy  = TUX64_LITERAL_UINT16((sizeof(ctx->clear_color_rsp_dma_buffer) / 2u) - 1u);
-   rsp_dma_transfer.row_bytes_skip  = TUX64_LITERAL_UINT16(0u);
-   rsp_dma_transfer.row_count       = TUX64_LITERAL_UINT8(1u);
-
-   /* copy the color fill buffer to RSP IMEM */
-   rsp_dma_transfer.addr_rdram = (Tux64UInt32)(Tux64UIntPtr)(&ctx->clear_color_rsp_dma_buffer);
-   tux64_boot_rsp_dma_start(&rsp_dma_transfer, TUX64_BOOT_RSP_DMA_DESTINATION_RSP_MEMORY);
-
-   /* start filling the framebuffer with the clear color */
-   rsp_dma_transfer.addr_rdram = (Tux64UInt32)(Tux64UIntPtr)framebuffer;
-   do {
-      tux64_boot_rsp_dma_wait_queue();
-      tux64_boot_rsp_dma_start(&rsp_dma_transfer, TUX64_BOOT_RSP_DMA_DESTINATION_RDRAM);
-      rsp_dma_transfer.addr_rdram += TUX64_LITERAL_UINT32(sizeof(ctx->clear_color_rsp_dma_buffer));
-      blocks--;
-   } while (blocks != TUX64_LITERAL_UINT32(0u));
-
-   /* fill the remainder bytes */
-   if (bytes_remainder != TUX64_LITERAL_UINT32(0u)) {
-      rsp_dma_transfer.row_bytes_copy  = ((Tux64UInt16)bytes_remainder - TUX64_LITERAL_UINT16(1u));
-      rsp_dma_transfer.row_count       = TUX64_LITERAL_UINT8(0u);
-
-      tux64_boot_rsp_dma_wait_queue();
-      tux64_boot_rsp_dma_start(&rsp_dma_transfer, TUX64_BOOT_RSP_DMA_DESTINATION_RDRAM);
-   }
+   /* RSP DMA is the fastest way to fill any chunk of memory on the N64, and */
+   /* filling the framebuffer with a repeating pattern of pixels is a perfect */
+   /* use case.  we let the final DMA transfer complete in the background, */
+   /* letting the caller manually sync the RSP. */
+   tux64_boot_bulk_fill(
+      framebuffer,
+      ctx->clear_color,
+      TUX64_LITERAL_UINT32(sizeof(framebuffer->pixels))
+   );
 
-   /* let the final DMA transfer complete in the backround, letting the */
-   /* caller manually sync the RSP. */
    return;
 }
 
@@ -289,8 +216,19 @@ tux64_boot_stage1_video_initialize_context(
    /* done to save on typing */
    ctx = &tux64_boot_stage1_video_context;
 
+   /* the framebuffers don't live in stage-1's .bss, but as an overlay at the */
+   /* end of memory.  this way, boot files which don't fit anywhere else can */
+   /* be loaded over them once they're released. */
+   ctx->framebuffers = (struct Tux64BootStage1VideoFramebuffer *)(Tux64UIntPtr)tux64_boot_stage1_memory_alloc_overlay(
+      TUX64_LITERAL_UINT32(sizeof(struct Tux64BootStage1VideoFramebuffer) * TUX64_BOOT_STAGE1_VIDEO_CONTEXT_FRAMEBUFFERS_COUNT)
+   );
+   ctx->framebuffers_released = TUX64_BOOLEAN_FALSE;
+
    tux64_boot_stage1_video_initialize_context_clear_color(clear_color);
    tux64_boot_sync_fence_initialize(&ctx->vblank_fence);
+   ctx->vblanks_triggered  = TUX64_LITERAL_UINT32(0u);
+   ctx->vblanks_ended      = TUX64_LITERAL_UINT32(0u);
+   ctx->vblanks_missed     = TUX64_LITERAL_UINT32(0u);
 
    /* clear non-rendering framebuffers to prevent garbage from being */
    /* displayed on startup */
@@ -592,13 +530,32 @@ tux64_boot_stage1_video_vblank_wait(void) {
 void
 tux64_boot_stage1_video_vblank_end(void) {
    struct Tux64BootStage1VideoContext * ctx;
+   Tux64UInt32 vblanks_triggered;
 
    ctx = &tux64_boot_stage1_video_context;
 
    tux64_boot_sync_fence_initialize(&ctx->vblank_fence);
+
+   if (!TUX64_BOOT_CONFIG_STATS_DISPLAY) {
+      return;
+   }
+
+   /* every vblank after the one we waited for was missed.  the first frame */
+   /* is skipped, since everything before it was spent initializing. */
+   vblanks_triggered = ctx->vblanks_triggered;
+   if (ctx->vblanks_ended != TUX64_LITERAL_UINT32(0u)) {
+      ctx->vblanks_missed += vblanks_triggered - ctx->vblanks_ended - TUX64_LITERAL_UINT32(1u);
+   }
+   ctx->vblanks_ended = vblanks_triggered;
+
    return;
 }
 
+Tux64UInt32
+tux64_boot_stage1_video_vblanks_missed(void) {
+   return tux64_boot_stage1_video_context.vblanks_missed;
+}
+
 Tux64Boolean
 tux64_boot_stage1_video_vblank_triggered(void) {
    struct Tux64BootStage1VideoContext * ctx;
@@ -614,6 +571,10 @@ tux64_boot_stage1_video_vblank_handler(void) {
 
    ctx = &tux64_boot_stage1_video_context;
 
+   if (TUX64_BOOT_CONFIG_STATS_DISPLAY) {
+      ctx->vblanks_triggered++;
+   }
+
    tux64_boot_sync_fence_signal(&ctx->vblank_fence);
    return;
 }
@@ -625,6 +586,10 @@ tux64_boot_stage1_video_swap_buffers(void) {
 
    ctx = &tux64_boot_stage1_video_context;
 
+   if (ctx->framebuffers_released == TUX64_BOOLEAN_TRUE) {
+      return;
+   }
+
    idx_rendering = tux64_boot_stage1_video_framebuffer_index_get_rendering();
    ctx->framebuffer_index_displaying = idx_rendering;
    tux64_boot_stage1_video_set_vi_framebuffer(idx_rendering);
@@ -641,6 +606,15 @@ tux64_boot_stage1_video_render_target_get(void) {
    return tux64_boot_stage1_video_framebuffer_get(idx);
 }
 
+const struct Tux64BootStage1VideoFramebuffer *
+tux64_boot_stage1_video_display_target_get(void) {
+   Tux64UInt8 idx;
+
+   idx = tux64_boot_stage1_video_framebuffer_index_get_displaying();
+
+   return tux64_boot_stage1_video_framebuffer_get(idx);
+}
+
 void
 tux64_boot_stage1_video_render_target_clear(void) {
    Tux64UInt8 idx;
@@ -651,3 +625,24 @@ tux64_boot_stage1_video_render_target_clear(void) {
    return;
 }
 
+void
+tux64_boot_stage1_video_framebuffers_release(void) {
+   struct Tux64BootStage1VideoContext * ctx;
+
+   ctx = &tux64_boot_stage1_video_context;
+
+   /* we can't disable video output entirely, since that also stops vblank */
+   /* interrupts, which everything from preemption to delays relies on. */
+   /* instead, we shrink the active video area down to nothing, which blanks */
+   /* the screen while keeping the VI running.  the VI stops reading from the */
+   /* framebuffers from the next scanline onwards. */
+   tux64_platform_mips_n64_mmio_registers_vi.h_video = TUX64_LITERAL_UINT32(0u);
+
+   ctx->framebuffers_released = TUX64_BOOLEAN_TRUE;
+   return;
+}
+
+Tux64Boolean
+tux64_boot_stage1_video_framebuffers_released(void) {
+   return tux64_boot_stage1_video_context.framebuffers_released;
+}
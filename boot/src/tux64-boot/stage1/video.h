@@ -52,7 +52,9 @@ enum Tux64BootStage1VideoPlatform {
 
 /*----------------------------------------------------------------------------*/
 /* Initializes the framebuffer video interface.  This must be called before   */
-/* using any other video functions.  Implicitly enables video output.         */
+/* using any other video functions.  Implicitly enables video output.  The    */
+/* framebuffers are allocated as the memory overlay, so the memory manager    */
+/* must be initialized first.                                                 */
 /*----------------------------------------------------------------------------*/
 void
 tux64_boot_stage1_video_initialize(
@@ -83,6 +85,14 @@ tux64_boot_stage1_video_vblank_wait(void);
 void
 tux64_boot_stage1_video_vblank_end(void);
 
+/*----------------------------------------------------------------------------*/
+/* Returns the number of vblanks which passed without a frame being ended,    */
+/* i.e. the number of lag frames.  This is always zero unless the statistics  */
+/* display is compiled in.                                                    */
+/*----------------------------------------------------------------------------*/
+Tux64UInt32
+tux64_boot_stage1_video_vblanks_missed(void);
+
 /*----------------------------------------------------------------------------*/
 /* Returns whether vblank was triggered.  This can be useful for writing CPU  */
 /* intensive code which is preemptive with respect to video output.           */
@@ -116,6 +126,13 @@ tux64_boot_stage1_video_swap_buffers(void);
 struct Tux64BootStage1VideoFramebuffer *
 tux64_boot_stage1_video_render_target_get(void);
 
+/*----------------------------------------------------------------------------*/
+/* Gets the framebuffer currently being displayed, in the cached segment.     */
+/* This is meaningless once the framebuffers are released.                    */
+/*----------------------------------------------------------------------------*/
+const struct Tux64BootStage1VideoFramebuffer *
+tux64_boot_stage1_video_display_target_get(void);
+
 /*----------------------------------------------------------------------------*/
 /* Clear the current render-target framebuffer to the clear color specified   */
 /* on initialization.  The RSP DMA engine must be available to queue a DMA    */
@@ -125,6 +142,22 @@ tux64_boot_stage1_video_render_target_get(void);
 void
 tux64_boot_stage1_video_render_target_clear(void);
 
+/*----------------------------------------------------------------------------*/
+/* Blanks the screen and gives up the framebuffers, so the memory they used   */
+/* can be loaded into.  Nothing may be rendered afterwards, and swapping      */
+/* buffers does nothing.  Video output stays enabled so vblank keeps          */
+/* triggering.  Any RSP DMA transfers into the framebuffers must be finished  */
+/* before calling this.                                                       */
+/*----------------------------------------------------------------------------*/
+void
+tux64_boot_stage1_video_framebuffers_release(void);
+
+/*----------------------------------------------------------------------------*/
+/* Returns whether tux64_boot_stage1_video_framebuffers_release() was called. */
+/*----------------------------------------------------------------------------*/
+Tux64Boolean
+tux64_boot_stage1_video_framebuffers_released(void);
+
 /*----------------------------------------------------------------------------*/
 #endif /* _TUX64_BOOT_STAGE1_VIDEO_H */
 
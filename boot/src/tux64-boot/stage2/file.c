@@ -12,11 +12,13 @@
 #include <tux64/checksum.h>
 #include <tux64/memory.h>
 #include <tux64/endian.h>
+#include <tux64/platform/mips/vr4300/cop0.h>
 #include "tux64-boot/header.h"
 #include "tux64-boot/load.h"
 #include "tux64-boot/halt.h"
 #include "tux64-boot/pi.h"
 #include "tux64-boot/flag.h"
+#include "tux64-boot/exec.h"
 #include "tux64-boot/stage2/status.h"
 
 static void
@@ -49,9 +51,13 @@ tux64_boot_stage2_file_verify_checksum(
 static void
 tux64_boot_stage2_file_load(
    Tux64UInt32 load_address,
-   const struct Tux64PlatformMipsN64BootHeaderFile * file
+   const struct Tux64PlatformMipsN64BootHeaderFile * file,
+   enum Tux64BootExecKernelTimingFile timing
 ) {
    struct Tux64BootPiDmaTransfer transfer;
+   Tux64UInt32 timestamp_start;
+
+   timestamp_start = tux64_platform_mips_vr4300_cop0_register_read_count();
 
    /* since stage-2 is non-interactive, file loading here is ez-pz. */
    transfer.addr_pibus  = file->addr_cart;
@@ -68,19 +74,25 @@ tux64_boot_stage2_file_load(
       );
    }
 
+   tux64_boot_exec_kernel_timing_file(
+      timing,
+      timestamp_start,
+      tux64_platform_mips_vr4300_cop0_register_read_count()
+   );
    return;
 }
 
 static void
 tux64_boot_stage2_file_load_optional(
    Tux64UInt32 load_address,
-   const struct Tux64PlatformMipsN64BootHeaderFile * file
+   const struct Tux64PlatformMipsN64BootHeaderFile * file,
+   enum Tux64BootExecKernelTimingFile timing
 ) {
    if (file->length == TUX64_LITERAL_UINT32(0u)) {
       return;
    }
 
-   tux64_boot_stage2_file_load(load_address, file);
+   tux64_boot_stage2_file_load(load_address, file, timing);
    return;
 }
 
@@ -90,7 +102,8 @@ tux64_boot_stage2_file_load_kernel(void) {
 
    tux64_boot_stage2_file_load(
       tux64_boot_load_allocations.required.kernel.address,
-      &tux64_boot_header_file_kernel()->image.file
+      &tux64_boot_header_file_kernel()->image.file,
+      TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_KERNEL
    );
 
    return;
@@ -102,7 +115,8 @@ tux64_boot_stage2_file_load_initramfs(void) {
 
    tux64_boot_stage2_file_load_optional(
       tux64_boot_load_allocations.optional.initramfs.address,
-      tux64_boot_header_file_initramfs()
+      tux64_boot_header_file_initramfs(),
+      TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_INITRAMFS
    );
 
    return;
@@ -114,7 +128,8 @@ tux64_boot_stage2_file_load_command_line(void) {
 
    tux64_boot_stage2_file_load_optional(
       tux64_boot_load_allocations.optional.command_line.address,
-      tux64_boot_header_file_command_line()
+      tux64_boot_header_file_command_line(),
+      TUX64_BOOT_EXEC_KERNEL_TIMING_FILE_COMMAND_LINE
    );
 
    return;
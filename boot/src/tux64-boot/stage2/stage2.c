@@ -21,6 +21,7 @@ tux64_boot_stage2_start_kernel(void) {
 
    entrypoint = (const void *)tux64_boot_header_file_kernel()->addr_entry;
 
+   tux64_boot_exec_kernel_segments_place(tux64_boot_load_allocations.required.kernel.address);
    tux64_boot_exec_kernel(entrypoint);
 }
 
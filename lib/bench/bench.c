@@ -0,0 +1,143 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* lib/bench/bench.c - Implementations for the shared benchmark runner.       */
+/*----------------------------------------------------------------------------*/
+
+/* we compile as strict C99, so clock_gettime() has to be requested */
+/* explicitly.  this must come before any system headers are included. */
+#define _POSIX_C_SOURCE 200809L
+
+#include "tux64/tux64.h"
+#include "bench/bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* this doesn't use any other tux64-lib functions, since some benchmarks are */
+/* built against their own copy of the code being measured instead of the */
+/* library. */
+
+#define TUX64_BENCH_ITERATIONS_DEFAULT\
+   (10u)
+
+/* each iteration calls the function until at least this much time passes, */
+/* so the clock's resolution doesn't matter even for tiny inputs. */
+#define TUX64_BENCH_SAMPLE_NANOSECONDS\
+   (5000000u)
+
+static Tux64UInt32
+tux64_bench_iterations = TUX64_LITERAL_UINT32(TUX64_BENCH_ITERATIONS_DEFAULT);
+
+Tux64Boolean
+tux64_bench_initialize(
+   int argc,
+   char ** argv
+) {
+   unsigned long iterations;
+   char * end;
+
+   if (argc < 2) {
+      return TUX64_BOOLEAN_TRUE;
+   }
+
+   iterations = strtoul(argv[1], &end, 10);
+   if (*argv[1] == '\0' || *end != '\0' || iterations == 0u || iterations > TUX64_UINT32_MAX_LITERAL) {
+      (void)fprintf(stderr, "error: invalid number of iterations \"%s\"\n", argv[1]);
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   tux64_bench_iterations = (Tux64UInt32)iterations;
+   return TUX64_BOOLEAN_TRUE;
+}
+
+static Tux64UInt64
+tux64_bench_now(void) {
+   struct timespec now;
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+   return (Tux64UInt64)now.tv_sec * TUX64_LITERAL_UINT64(1000000000u) + (Tux64UInt64)now.tv_nsec;
+}
+
+static Tux64UInt64
+tux64_bench_sample(
+   Tux64UInt32 calls,
+   Tux64BenchFunction function,
+   void * context
+) {
+   Tux64UInt64 start;
+
+   start = tux64_bench_now();
+   while (calls != TUX64_LITERAL_UINT32(0u)) {
+      function(context);
+      calls--;
+   }
+
+   return tux64_bench_now() - start;
+}
+
+void
+tux64_bench_run(
+   const char * name,
+   Tux64UInt32 bytes,
+   Tux64BenchFunction function,
+   void * context
+) {
+   Tux64UInt32 calls;
+   Tux64UInt32 i;
+   Tux64UInt64 elapsed;
+   Tux64UInt64 fastest;
+   double fastest_per_call;
+
+   /* this also warms up the caches before the timed iterations */
+   calls = TUX64_LITERAL_UINT32(1u);
+   elapsed = tux64_bench_sample(calls, function, context);
+   while (elapsed < TUX64_LITERAL_UINT64(TUX64_BENCH_SAMPLE_NANOSECONDS)) {
+      calls *= TUX64_LITERAL_UINT32(2u);
+      elapsed = tux64_bench_sample(calls, function, context);
+   }
+
+   fastest = elapsed;
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != tux64_bench_iterations) {
+      elapsed = tux64_bench_sample(calls, function, context);
+      if (elapsed < fastest) {
+         fastest = elapsed;
+      }
+
+      i++;
+   }
+
+   fastest_per_call = (double)fastest / (double)calls;
+
+   (void)printf("%s\t%u\t%u\t%.2f\t%.0f\n", name, (unsigned int)bytes, (unsigned int)tux64_bench_iterations, fastest_per_call, (double)bytes * 1000000000.0 / fastest_per_call);
+   (void)fflush(stdout);
+   return;
+}
+
+void
+tux64_bench_randomize(
+   Tux64UInt8 * data,
+   Tux64UInt32 bytes
+) {
+   Tux64UInt32 state;
+
+   /* xorshift32, so every run measures the same data */
+   state = TUX64_LITERAL_UINT32(0x7475786Cu);
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      state ^= state << 13u;
+      state ^= state >> 17u;
+      state ^= state << 5u;
+
+      *data = (Tux64UInt8)state;
+
+      data++;
+      bytes--;
+   }
+
+   return;
+}
+
@@ -0,0 +1,63 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* lib/bench/bench.h - Header for the shared benchmark runner.                */
+/*----------------------------------------------------------------------------*/
+
+#ifndef _TUX64_BENCH_BENCH_H
+#define _TUX64_BENCH_BENCH_H
+/*----------------------------------------------------------------------------*/
+
+#include "tux64/tux64.h"
+
+/*----------------------------------------------------------------------------*/
+/* Runs the code being measured once.  'context' is passed through from       */
+/* tux64_bench_run() untouched.                                               */
+/*----------------------------------------------------------------------------*/
+typedef void (*Tux64BenchFunction)(
+   void * context
+);
+
+/*----------------------------------------------------------------------------*/
+/* Parses the number of iterations from the command-line, which is the only   */
+/* argument any of the benchmarks take.  If it's missing, this defaults to    */
+/* 10.  If it's invalid, an error is printed and false is returned.           */
+/*----------------------------------------------------------------------------*/
+Tux64Boolean
+tux64_bench_initialize(
+   int argc,
+   char ** argv
+);
+
+/*----------------------------------------------------------------------------*/
+/* Times 'function' and prints the result as a line of tab-separated values   */
+/* with the following columns:                                                */
+/*                                                                            */
+/*    name, bytes, iterations, fastest run in nanoseconds, bytes per second   */
+/*                                                                            */
+/* which are the same columns printed by scripts/benchmark.sh.  Each          */
+/* iteration calls 'function' enough times in a row to be timed accurately,   */
+/* and the fastest time for a single call is kept to reduce noise.  'bytes'   */
+/* is how many bytes a single call processes.                                 */
+/*----------------------------------------------------------------------------*/
+void
+tux64_bench_run(
+   const char * name,
+   Tux64UInt32 bytes,
+   Tux64BenchFunction function,
+   void * context
+);
+
+/*----------------------------------------------------------------------------*/
+/* Fills 'data' with the same pseudo-random bytes on every run.               */
+/*----------------------------------------------------------------------------*/
+void
+tux64_bench_randomize(
+   Tux64UInt8 * data,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_BENCH_BENCH_H */
+
@@ -0,0 +1,94 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* lib/bench/checksum.c - Benchmarks for checksum functions.                  */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64/tux64.h"
+#include "tux64/checksum.h"
+
+#include "bench/bench.h"
+
+#include <stdio.h>
+
+#define TUX64_BENCH_CHECKSUM_BYTES_MAX\
+   (1048576u)
+
+struct Tux64BenchChecksumAlgorithm {
+   const char * name;
+   const struct Tux64ChecksumFunction * function;
+};
+
+struct Tux64BenchChecksumContext {
+   const struct Tux64ChecksumFunction * function;
+   Tux64UInt32 bytes;
+   Tux64UInt8 digest;
+};
+
+static const struct Tux64BenchChecksumAlgorithm
+tux64_bench_checksum_algorithms [] = {
+   {
+      .name       = "fletcher-64-32",
+      .function   = &tux64_checksum_fletcher_64_32
+   }
+};
+
+/* a single header, a page, and something far bigger than the caches */
+static const Tux64UInt32
+tux64_bench_checksum_sizes [] = {
+   TUX64_LITERAL_UINT32(64u),
+   TUX64_LITERAL_UINT32(4096u),
+   TUX64_LITERAL_UINT32(TUX64_BENCH_CHECKSUM_BYTES_MAX)
+};
+
+static Tux64UInt8
+tux64_bench_checksum_data [TUX64_BENCH_CHECKSUM_BYTES_MAX];
+
+static void
+tux64_bench_checksum_digest(
+   void * context
+) {
+   struct Tux64BenchChecksumContext * checksum;
+   struct Tux64ChecksumContext state;
+
+   checksum = (struct Tux64BenchChecksumContext *)context;
+
+   checksum->function->initialize(&state);
+   checksum->function->digest(&state, tux64_bench_checksum_data, checksum->bytes);
+   checksum->digest = *checksum->function->finalize(&state);
+
+   return;
+}
+
+int main(int argc, char ** argv) {
+   struct Tux64BenchChecksumContext context;
+   char name [64];
+   Tux64UInt32 i;
+   Tux64UInt32 j;
+
+   if (tux64_bench_initialize(argc, argv) == TUX64_BOOLEAN_FALSE) {
+      return 1;
+   }
+
+   tux64_bench_randomize(tux64_bench_checksum_data, TUX64_LITERAL_UINT32(TUX64_BENCH_CHECKSUM_BYTES_MAX));
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(tux64_bench_checksum_algorithms))) {
+      j = TUX64_LITERAL_UINT32(0u);
+      while (j != TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(tux64_bench_checksum_sizes))) {
+         context.function = tux64_bench_checksum_algorithms[i].function;
+         context.bytes = tux64_bench_checksum_sizes[j];
+
+         (void)snprintf(name, sizeof(name), "checksum-%s-%u", tux64_bench_checksum_algorithms[i].name, (unsigned int)context.bytes);
+         tux64_bench_run(name, context.bytes, tux64_bench_checksum_digest, &context);
+
+         j++;
+      }
+
+      i++;
+   }
+
+   return 0;
+}
+
@@ -0,0 +1,131 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* lib/bench/endian.c - Benchmarks for endian functions.                      */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64/tux64.h"
+#include "tux64/endian.h"
+
+#include "bench/bench.h"
+
+#include <stdio.h>
+
+/* converting to the native format is a no-op, so always swap */
+#if TUX64_PLATFORM_CPU_ENDIAN_NATIVE_BIG
+#define TUX64_BENCH_ENDIAN_FORMAT_SWAPPED TUX64_ENDIAN_FORMAT_LITTLE
+#else /* TUX64_PLATFORM_CPU_ENDIAN_NATIVE_BIG */
+#define TUX64_BENCH_ENDIAN_FORMAT_SWAPPED TUX64_ENDIAN_FORMAT_BIG
+#endif /* TUX64_PLATFORM_CPU_ENDIAN_NATIVE_BIG */
+
+#define TUX64_BENCH_ENDIAN_BYTES_MAX\
+   (1048576u)
+
+struct Tux64BenchEndianContext {
+   Tux64UInt32 elements;
+   Tux64UInt32 bytes_per_element;
+};
+
+struct Tux64BenchEndianBenchmark {
+   const char * name;
+   Tux64BenchFunction function;
+};
+
+/* a single ELF header's worth of fields, a page, and something far bigger */
+/* than the caches */
+static const Tux64UInt32
+tux64_bench_endian_sizes [] = {
+   TUX64_LITERAL_UINT32(64u),
+   TUX64_LITERAL_UINT32(4096u),
+   TUX64_LITERAL_UINT32(TUX64_BENCH_ENDIAN_BYTES_MAX)
+};
+
+static const Tux64UInt32
+tux64_bench_endian_element_sizes [] = {
+   TUX64_LITERAL_UINT32(sizeof(Tux64UInt16)),
+   TUX64_LITERAL_UINT32(sizeof(Tux64UInt32)),
+   TUX64_LITERAL_UINT32(sizeof(Tux64UInt64))
+};
+
+static Tux64UInt8
+tux64_bench_endian_output [TUX64_BENCH_ENDIAN_BYTES_MAX];
+static Tux64UInt8
+tux64_bench_endian_data [TUX64_BENCH_ENDIAN_BYTES_MAX];
+
+static void
+tux64_bench_endian_convert_array_inplace(
+   void * context
+) {
+   struct Tux64BenchEndianContext * endian;
+
+   endian = (struct Tux64BenchEndianContext *)context;
+
+   tux64_endian_convert_array_inplace(tux64_bench_endian_data, endian->elements, endian->bytes_per_element, TUX64_BENCH_ENDIAN_FORMAT_SWAPPED);
+   return;
+}
+
+static void
+tux64_bench_endian_convert_array_copy(
+   void * context
+) {
+   struct Tux64BenchEndianContext * endian;
+
+   endian = (struct Tux64BenchEndianContext *)context;
+
+   tux64_endian_convert_array_copy(tux64_bench_endian_output, tux64_bench_endian_data, endian->elements, endian->bytes_per_element, TUX64_BENCH_ENDIAN_FORMAT_SWAPPED);
+   return;
+}
+
+static const struct Tux64BenchEndianBenchmark
+tux64_bench_endian_benchmarks [] = {
+   {
+      .name       = "convert-array-inplace",
+      .function   = tux64_bench_endian_convert_array_inplace
+   },
+   {
+      .name       = "convert-array-copy",
+      .function   = tux64_bench_endian_convert_array_copy
+   }
+};
+
+int main(int argc, char ** argv) {
+   struct Tux64BenchEndianContext context;
+   char name [64];
+   Tux64UInt32 bytes;
+   Tux64UInt32 i;
+   Tux64UInt32 j;
+   Tux64UInt32 k;
+
+   if (tux64_bench_initialize(argc, argv) == TUX64_BOOLEAN_FALSE) {
+      return 1;
+   }
+
+   tux64_bench_randomize(tux64_bench_endian_data, TUX64_LITERAL_UINT32(TUX64_BENCH_ENDIAN_BYTES_MAX));
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(tux64_bench_endian_benchmarks))) {
+      j = TUX64_LITERAL_UINT32(0u);
+      while (j != TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(tux64_bench_endian_element_sizes))) {
+         k = TUX64_LITERAL_UINT32(0u);
+         while (k != TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(tux64_bench_endian_sizes))) {
+            bytes = tux64_bench_endian_sizes[k];
+
+            context.bytes_per_element = tux64_bench_endian_element_sizes[j];
+            context.elements = bytes / context.bytes_per_element;
+
+            (void)snprintf(name, sizeof(name), "endian-%s-%u-%u", tux64_bench_endian_benchmarks[i].name, (unsigned int)(context.bytes_per_element * 8u), (unsigned int)bytes);
+            tux64_bench_run(name, bytes, tux64_bench_endian_benchmarks[i].function, &context);
+
+            k++;
+         }
+
+         j++;
+      }
+
+      i++;
+   }
+
+   return 0;
+}
+
@@ -0,0 +1,276 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* lib/bench/memory.c - Benchmarks for memory functions.                      */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64/tux64.h"
+#include "tux64/memory.h"
+
+#include "bench/bench.h"
+
+#include <stdio.h>
+
+/* this is built twice, once against the library and once with */
+/* TUX64_HAVE_STRING_H disabled, so libc and our freestanding fallbacks can */
+/* be compared side-by-side. */
+#if TUX64_HAVE_STRING_H
+#define TUX64_BENCH_MEMORY_PREFIX\
+   "memory"
+#else /* TUX64_HAVE_STRING_H */
+#define TUX64_BENCH_MEMORY_PREFIX\
+   "memory-fallback"
+#endif /* TUX64_HAVE_STRING_H */
+
+#define TUX64_BENCH_MEMORY_BYTES_MAX\
+   (1048576u)
+
+/* room for the unaligned offset and the overlap when moving */
+#define TUX64_BENCH_MEMORY_BUFFER_WORDS\
+   ((TUX64_BENCH_MEMORY_BYTES_MAX / sizeof(Tux64UInt64)) + 2u)
+
+/* the largest element passed to tux64_memory_fill() */
+#define TUX64_BENCH_MEMORY_ELEMENT_BYTES_MAX\
+   (8u)
+
+enum Tux64BenchMemoryOperation {
+   TUX64_BENCH_MEMORY_OPERATION_COPY,
+   TUX64_BENCH_MEMORY_OPERATION_MOVE,
+   TUX64_BENCH_MEMORY_OPERATION_FILL_8,
+   TUX64_BENCH_MEMORY_OPERATION_FILL_32,
+   TUX64_BENCH_MEMORY_OPERATION_FILL_64,
+   TUX64_BENCH_MEMORY_OPERATION_COMPARE
+};
+
+struct Tux64BenchMemoryContext {
+   Tux64UInt8 * dest;
+   const Tux64UInt8 * src;
+   Tux64UInt32 bytes;
+   Tux64Boolean equal;
+};
+
+struct Tux64BenchMemoryBenchmark {
+   const char * name;
+   Tux64BenchFunction function;
+   enum Tux64BenchMemoryOperation operation;
+};
+
+/* short copies like the ones in the boot headers, a page, and something */
+/* far bigger than the caches */
+static const Tux64UInt32
+tux64_bench_memory_sizes [] = {
+   TUX64_LITERAL_UINT32(16u),
+   TUX64_LITERAL_UINT32(256u),
+   TUX64_LITERAL_UINT32(4096u),
+   TUX64_LITERAL_UINT32(TUX64_BENCH_MEMORY_BYTES_MAX)
+};
+
+static const Tux64UInt8
+tux64_bench_memory_sentinel [TUX64_BENCH_MEMORY_ELEMENT_BYTES_MAX] = {
+   0x74u, 0x75u, 0x78u, 0x36u, 0x34u, 0x00u, 0x5au, 0xa5u
+};
+
+static Tux64UInt64
+tux64_bench_memory_dest [TUX64_BENCH_MEMORY_BUFFER_WORDS];
+static Tux64UInt64
+tux64_bench_memory_src [TUX64_BENCH_MEMORY_BUFFER_WORDS];
+
+static void
+tux64_bench_memory_copy(
+   void * context
+) {
+   struct Tux64BenchMemoryContext * memory;
+
+   memory = (struct Tux64BenchMemoryContext *)context;
+
+   tux64_memory_copy(memory->dest, memory->src, memory->bytes);
+   return;
+}
+
+static void
+tux64_bench_memory_move(
+   void * context
+) {
+   struct Tux64BenchMemoryContext * memory;
+
+   memory = (struct Tux64BenchMemoryContext *)context;
+
+   tux64_memory_move(memory->dest, memory->src, memory->bytes);
+   return;
+}
+
+static void
+tux64_bench_memory_fill(
+   void * context,
+   Tux64UInt32 bytes_per_element
+) {
+   struct Tux64BenchMemoryContext * memory;
+
+   memory = (struct Tux64BenchMemoryContext *)context;
+
+   tux64_memory_fill(memory->dest, tux64_bench_memory_sentinel, memory->bytes / bytes_per_element, bytes_per_element);
+   return;
+}
+
+static void
+tux64_bench_memory_fill_8(
+   void * context
+) {
+   tux64_bench_memory_fill(context, TUX64_LITERAL_UINT32(sizeof(Tux64UInt8)));
+   return;
+}
+
+static void
+tux64_bench_memory_fill_32(
+   void * context
+) {
+   tux64_bench_memory_fill(context, TUX64_LITERAL_UINT32(sizeof(Tux64UInt32)));
+   return;
+}
+
+static void
+tux64_bench_memory_fill_64(
+   void * context
+) {
+   tux64_bench_memory_fill(context, TUX64_LITERAL_UINT32(sizeof(Tux64UInt64)));
+   return;
+}
+
+static void
+tux64_bench_memory_compare(
+   void * context
+) {
+   struct Tux64BenchMemoryContext * memory;
+
+   memory = (struct Tux64BenchMemoryContext *)context;
+
+   memory->equal = tux64_memory_compare_with_equal_lengths(memory->dest, memory->src, memory->bytes);
+   return;
+}
+
+static const struct Tux64BenchMemoryBenchmark
+tux64_bench_memory_benchmarks [] = {
+   {
+      .name       = "copy",
+      .function   = tux64_bench_memory_copy,
+      .operation  = TUX64_BENCH_MEMORY_OPERATION_COPY
+   },
+   {
+      .name       = "move",
+      .function   = tux64_bench_memory_move,
+      .operation  = TUX64_BENCH_MEMORY_OPERATION_MOVE
+   },
+   {
+      .name       = "fill-8",
+      .function   = tux64_bench_memory_fill_8,
+      .operation  = TUX64_BENCH_MEMORY_OPERATION_FILL_8
+   },
+   {
+      .name       = "fill-32",
+      .function   = tux64_bench_memory_fill_32,
+      .operation  = TUX64_BENCH_MEMORY_OPERATION_FILL_32
+   },
+   {
+      .name       = "fill-64",
+      .function   = tux64_bench_memory_fill_64,
+      .operation  = TUX64_BENCH_MEMORY_OPERATION_FILL_64
+   },
+   {
+      .name       = "compare",
+      .function   = tux64_bench_memory_compare,
+      .operation  = TUX64_BENCH_MEMORY_OPERATION_COMPARE
+   }
+};
+
+static void
+tux64_bench_memory_prepare(
+   struct Tux64BenchMemoryContext * context,
+   enum Tux64BenchMemoryOperation operation,
+   Tux64UInt32 bytes,
+   Tux64UInt32 offset
+) {
+   Tux64UInt8 * dest;
+   Tux64UInt8 * src;
+
+   dest = (Tux64UInt8 *)tux64_bench_memory_dest + offset;
+   src = (Tux64UInt8 *)tux64_bench_memory_src;
+
+   context->bytes = bytes;
+
+   switch (operation) {
+      case TUX64_BENCH_MEMORY_OPERATION_COPY:
+      case TUX64_BENCH_MEMORY_OPERATION_FILL_8:
+      case TUX64_BENCH_MEMORY_OPERATION_FILL_32:
+      case TUX64_BENCH_MEMORY_OPERATION_FILL_64:
+         context->dest = dest;
+         context->src = src;
+         break;
+      case TUX64_BENCH_MEMORY_OPERATION_MOVE:
+         /* shift a buffer up over itself, like moving the tail of an array */
+         context->dest = dest + sizeof(Tux64UInt64);
+         context->src = dest;
+         break;
+      case TUX64_BENCH_MEMORY_OPERATION_COMPARE:
+         /* the worst case, where every byte has to be looked at */
+         tux64_bench_randomize(dest, bytes);
+         tux64_bench_randomize(src, bytes);
+         context->dest = dest;
+         context->src = src;
+         break;
+      default:
+         TUX64_UNREACHABLE;
+   }
+
+   return;
+}
+
+int main(int argc, char ** argv) {
+   struct Tux64BenchMemoryContext context;
+   const struct Tux64BenchMemoryBenchmark * benchmark;
+   char name [64];
+   Tux64UInt32 bytes;
+   Tux64UInt32 offset;
+   Tux64UInt32 i;
+   Tux64UInt32 j;
+
+   if (tux64_bench_initialize(argc, argv) == TUX64_BOOLEAN_FALSE) {
+      return 1;
+   }
+
+   tux64_bench_randomize((Tux64UInt8 *)tux64_bench_memory_src, TUX64_LITERAL_UINT32(sizeof(tux64_bench_memory_src)));
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(tux64_bench_memory_benchmarks))) {
+      benchmark = &tux64_bench_memory_benchmarks[i];
+
+      j = TUX64_LITERAL_UINT32(0u);
+      while (j != TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(tux64_bench_memory_sizes))) {
+         bytes = tux64_bench_memory_sizes[j];
+
+         /* once with both pointers word-aligned, then once with the */
+         /* destination a byte off, which takes the slow path */
+         offset = TUX64_LITERAL_UINT32(0u);
+         while (offset != TUX64_LITERAL_UINT32(2u)) {
+            tux64_bench_memory_prepare(&context, benchmark->operation, bytes, offset);
+
+            if (offset == TUX64_LITERAL_UINT32(0u)) {
+               (void)snprintf(name, sizeof(name), "%s-%s-%u", TUX64_BENCH_MEMORY_PREFIX, benchmark->name, (unsigned int)bytes);
+            } else {
+               (void)snprintf(name, sizeof(name), "%s-%s-%u-unaligned", TUX64_BENCH_MEMORY_PREFIX, benchmark->name, (unsigned int)bytes);
+            }
+
+            tux64_bench_run(name, bytes, benchmark->function, &context);
+
+            offset++;
+         }
+
+         j++;
+      }
+
+      i++;
+   }
+
+   return 0;
+}
+
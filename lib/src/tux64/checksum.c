@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/*                          Copyright (C) Tux64 2025                          */
+/*                       Copyright (C) Tux64 2025, 2026                       */
 /*                    https://github.com/bradleycha/tux64                     */
 /*----------------------------------------------------------------------------*/
 /* lib/src/tux64/checksum.c - Implementations for checksum functions.         */
@@ -127,6 +127,11 @@ tux64_checksum_fletcher_64_32_fill_word_buffer(
    return taken;
 }
 
+/* whole words are converted this many at a time into a buffer on the stack, */
+/* which is kept small since this also runs in the bootloader. */
+#define TUX64_CHECKSUM_FLETCHER_64_32_DIGEST_CHUNK_WORDS\
+   (64u)
+
 static void
 tux64_checksum_fletcher_64_32_digest(
    struct Tux64ChecksumContext * context,
@@ -136,7 +141,10 @@ tux64_checksum_fletcher_64_32_digest(
    struct _Tux64ChecksumContextAlgorithmFletcher6432 * context_fletcher;
    const Tux64UInt8 * iter_data;
    Tux64UInt32 bytes_taken;
-   union Tux64Int32 word;
+   Tux64UInt32 words [TUX64_CHECKSUM_FLETCHER_64_32_DIGEST_CHUNK_WORDS];
+   const Tux64UInt32 * iter_words;
+   Tux64UInt32 words_chunk;
+   Tux64UInt32 words_remaining;
 
    context_fletcher = &context->algorithm.fletcher_64_32;
    iter_data = data;
@@ -146,19 +154,38 @@ tux64_checksum_fletcher_64_32_digest(
    iter_data += bytes_taken;
    bytes -= bytes_taken;
 
-   /* digest all whole words */
+   /* if there wasn't enough data to complete the word buffer, it's all in */
+   /* the word buffer now, which we can't overwrite below. */
+   if (context_fletcher->word_buffer_capacity != TUX64_LITERAL_UINT8(TUX64_ARRAY_ELEMENTS(context_fletcher->word_buffer))) {
+      return;
+   }
+
+   /* digest all whole words, converting them in bulk first */
    while (bytes >= TUX64_LITERAL_UINT32(sizeof(Tux64UInt32))) {
-      tux64_endian_convert_copy(
-         word.bytes,
+      words_chunk = bytes / TUX64_LITERAL_UINT32(sizeof(Tux64UInt32));
+      if (words_chunk > TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(words))) {
+         words_chunk = TUX64_LITERAL_UINT32(TUX64_ARRAY_ELEMENTS(words));
+      }
+
+      tux64_endian_convert_array_copy(
+         (Tux64UInt8 *)words,
          iter_data,
+         words_chunk,
          TUX64_LITERAL_UINT32(sizeof(Tux64UInt32)),
          TUX64_ENDIAN_FORMAT_BIG
       );
 
-      tux64_checksum_fletcher_64_32_digest_word(context_fletcher, word.uint);
+      iter_words = words;
+      words_remaining = words_chunk;
+      while (words_remaining != TUX64_LITERAL_UINT32(0u)) {
+         tux64_checksum_fletcher_64_32_digest_word(context_fletcher, *iter_words);
+
+         iter_words++;
+         words_remaining--;
+      }
 
-      iter_data += sizeof(Tux64UInt32);
-      bytes -= TUX64_LITERAL_UINT32(sizeof(Tux64UInt32));
+      iter_data += words_chunk * sizeof(Tux64UInt32);
+      bytes -= words_chunk * TUX64_LITERAL_UINT32(sizeof(Tux64UInt32));
    }
 
    /* copy any remaining bytes into the word buffer */
@@ -188,11 +215,48 @@ tux64_checksum_fletcher_64_32_finalize(
    return context_fletcher->sum_hi.bytes;
 }
 
+static void
+tux64_checksum_fletcher_64_32_merge(
+   struct Tux64ChecksumContext * head,
+   const struct Tux64ChecksumContext * tail,
+   Tux64UInt32 tail_bytes
+) {
+   struct _Tux64ChecksumContextAlgorithmFletcher6432 * head_fletcher;
+   const struct _Tux64ChecksumContextAlgorithmFletcher6432 * tail_fletcher;
+   Tux64UInt32 tail_words;
+
+   head_fletcher = &head->algorithm.fletcher_64_32;
+   tail_fletcher = &tail->algorithm.fletcher_64_32;
+
+   /* only whole words have been digested into the sums, while any trailing */
+   /* bytes are still waiting in the word buffer. */
+   tail_words = tail_bytes / TUX64_LITERAL_UINT32(sizeof(Tux64UInt32));
+
+   /* the second sum is the sum of the first sum after every word.  every */
+   /* first sum in the tail would have started from the head's first sum */
+   /* instead of zero, so the head's first sum is added once per tail word. */
+   /* all of this wraps modulo 2^32 just like digesting does, so the result */
+   /* is identical. */
+   head_fletcher->sum_lo.uint += tail_fletcher->sum_lo.uint + (head_fletcher->sum_hi.uint * tail_words);
+   head_fletcher->sum_hi.uint += tail_fletcher->sum_hi.uint;
+
+   tux64_memory_copy(
+      head_fletcher->word_buffer,
+      tail_fletcher->word_buffer,
+      TUX64_LITERAL_UINT32(sizeof(head_fletcher->word_buffer))
+   );
+   head_fletcher->word_buffer_capacity = tail_fletcher->word_buffer_capacity;
+
+   return;
+}
+
 const struct Tux64ChecksumFunction
 tux64_checksum_fletcher_64_32 = {
-   .initialize    = tux64_checksum_fletcher_64_32_initialize,
-   .digest        = tux64_checksum_fletcher_64_32_digest,
-   .finalize      = tux64_checksum_fletcher_64_32_finalize,
-   .digest_bytes  = TUX64_LITERAL_UINT8(TUX64_CHECKSUM_FLETCHER_64_32_DIGEST_BYTES)
+   .initialize       = tux64_checksum_fletcher_64_32_initialize,
+   .digest           = tux64_checksum_fletcher_64_32_digest,
+   .finalize         = tux64_checksum_fletcher_64_32_finalize,
+   .merge            = tux64_checksum_fletcher_64_32_merge,
+   .digest_bytes     = TUX64_LITERAL_UINT8(TUX64_CHECKSUM_FLETCHER_64_32_DIGEST_BYTES),
+   .merge_alignment  = TUX64_LITERAL_UINT8(TUX64_CHECKSUM_FLETCHER_64_32_MERGE_ALIGNMENT)
 };
 
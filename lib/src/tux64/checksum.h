@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/*                          Copyright (C) Tux64 2025                          */
+/*                       Copyright (C) Tux64 2025, 2026                       */
 /*                    https://github.com/bradleycha/tux64                     */
 /*----------------------------------------------------------------------------*/
 /* lib/src/tux64/checksum.h - Header for checksum functions.                  */
@@ -39,11 +39,27 @@ typedef Tux64UInt8 * (*Tux64ChecksumFunctionFinalize)(
    struct Tux64ChecksumContext * context
 );
 
+/*----------------------------------------------------------------------------*/
+/* Merges 'tail' into 'head', leaving 'head' as if the data digested into     */
+/* 'tail' had been digested into 'head' instead.  'tail_bytes' is the total   */
+/* number of bytes digested into 'tail' since it was initialized.  The total  */
+/* number of bytes digested into 'head' must be a multiple of the function's  */
+/* merge alignment.  This allows separate chunks of data to be digested in    */
+/* any order or at the same time, so long as they're merged back in order.    */
+/*----------------------------------------------------------------------------*/
+typedef void (*Tux64ChecksumFunctionMerge)(
+   struct Tux64ChecksumContext * head,
+   const struct Tux64ChecksumContext * tail,
+   Tux64UInt32 tail_bytes
+);
+
 struct Tux64ChecksumFunction {
    Tux64ChecksumFunctionInitialize initialize;
    Tux64ChecksumFunctionDigest digest;
    Tux64ChecksumFunctionFinalize finalize;
+   Tux64ChecksumFunctionMerge merge;
    Tux64UInt8 digest_bytes;
+   Tux64UInt8 merge_alignment;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -54,6 +70,8 @@ struct Tux64ChecksumFunction {
 /*----------------------------------------------------------------------------*/
 #define TUX64_CHECKSUM_FLETCHER_64_32_DIGEST_BYTES\
    4u
+#define TUX64_CHECKSUM_FLETCHER_64_32_MERGE_ALIGNMENT\
+   4u
 extern const struct Tux64ChecksumFunction
 tux64_checksum_fletcher_64_32;
 
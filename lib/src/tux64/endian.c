@@ -10,6 +10,13 @@
 
 #include "tux64/memory.h"
 
+/* the array conversions access elements through these so they can be */
+/* unaligned and alias anything, which also lets the compiler vectorize the */
+/* loops into byte shuffles where the host supports it. */
+typedef Tux64UInt16 __attribute__((may_alias, aligned(1))) Tux64EndianUnalignedUInt16;
+typedef Tux64UInt32 __attribute__((may_alias, aligned(1))) Tux64EndianUnalignedUInt32;
+typedef Tux64UInt64 __attribute__((may_alias, aligned(1))) Tux64EndianUnalignedUInt64;
+
 static void
 tux64_endian_swap_inplace(
    Tux64UInt8 * restrict data,
@@ -85,6 +92,145 @@ tux64_endian_convert_copy(
    return;
 }
 
+/* 'output' and 'data' may be the same buffer, but must not partially */
+/* overlap. */
+static void
+tux64_endian_swap_array_uint16(
+   Tux64UInt8 * output,
+   const Tux64UInt8 * data,
+   Tux64UInt32 elements
+) {
+   Tux64EndianUnalignedUInt16 * iter_output;
+   const Tux64EndianUnalignedUInt16 * iter_data;
+
+   iter_output = (Tux64EndianUnalignedUInt16 *)output;
+   iter_data = (const Tux64EndianUnalignedUInt16 *)data;
+   while (elements != TUX64_LITERAL_UINT32(0u)) {
+      *iter_output = __builtin_bswap16(*iter_data);
+
+      iter_output++;
+      iter_data++;
+      elements--;
+   }
+
+   return;
+}
+
+static void
+tux64_endian_swap_array_uint32(
+   Tux64UInt8 * output,
+   const Tux64UInt8 * data,
+   Tux64UInt32 elements
+) {
+   Tux64EndianUnalignedUInt32 * iter_output;
+   const Tux64EndianUnalignedUInt32 * iter_data;
+
+   iter_output = (Tux64EndianUnalignedUInt32 *)output;
+   iter_data = (const Tux64EndianUnalignedUInt32 *)data;
+   while (elements != TUX64_LITERAL_UINT32(0u)) {
+      *iter_output = __builtin_bswap32(*iter_data);
+
+      iter_output++;
+      iter_data++;
+      elements--;
+   }
+
+   return;
+}
+
+static void
+tux64_endian_swap_array_uint64(
+   Tux64UInt8 * output,
+   const Tux64UInt8 * data,
+   Tux64UInt32 elements
+) {
+   Tux64EndianUnalignedUInt64 * iter_output;
+   const Tux64EndianUnalignedUInt64 * iter_data;
+
+   iter_output = (Tux64EndianUnalignedUInt64 *)output;
+   iter_data = (const Tux64EndianUnalignedUInt64 *)data;
+   while (elements != TUX64_LITERAL_UINT32(0u)) {
+      *iter_output = __builtin_bswap64(*iter_data);
+
+      iter_output++;
+      iter_data++;
+      elements--;
+   }
+
+   return;
+}
+
+void
+tux64_endian_convert_array_inplace(
+   Tux64UInt8 * data,
+   Tux64UInt32 elements,
+   Tux64UInt32 bytes_per_element,
+   enum Tux64EndianFormat format
+) {
+   if (format == TUX64_ENDIAN_FORMAT_NATIVE) {
+      return;
+   }
+
+   switch (bytes_per_element) {
+      case 2u:
+         tux64_endian_swap_array_uint16(data, data, elements);
+         break;
+      case 4u:
+         tux64_endian_swap_array_uint32(data, data, elements);
+         break;
+      case 8u:
+         tux64_endian_swap_array_uint64(data, data, elements);
+         break;
+      default:
+         while (elements != TUX64_LITERAL_UINT32(0u)) {
+            tux64_endian_swap_inplace(data, bytes_per_element);
+
+            data += bytes_per_element;
+            elements--;
+         }
+         break;
+   }
+
+   return;
+}
+
+void
+tux64_endian_convert_array_copy(
+   Tux64UInt8 * restrict output,
+   const Tux64UInt8 * restrict data,
+   Tux64UInt32 elements,
+   Tux64UInt32 bytes_per_element,
+   enum Tux64EndianFormat format
+) {
+   if (format == TUX64_ENDIAN_FORMAT_NATIVE) {
+      tux64_memory_copy(output, data, elements * bytes_per_element);
+      return;
+   }
+
+   switch (bytes_per_element) {
+      case 2u:
+         tux64_endian_swap_array_uint16(output, data, elements);
+         break;
+      case 4u:
+         tux64_endian_swap_array_uint32(output, data, elements);
+         break;
+      case 8u:
+         tux64_endian_swap_array_uint64(output, data, elements);
+         break;
+      default:
+         while (elements != TUX64_LITERAL_UINT32(0u)) {
+            tux64_endian_swap_copy(output, data, bytes_per_element);
+
+            output += bytes_per_element;
+            data += bytes_per_element;
+            elements--;
+         }
+         break;
+   }
+
+   return;
+}
+
 Tux64UInt16
 tux64_endian_convert_uint16(
    Tux64UInt16 value,
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/*                          Copyright (C) Tux64 2025                          */
+/*                       Copyright (C) Tux64 2025, 2026                       */
 /*                    https://github.com/bradleycha/tux64                     */
 /*----------------------------------------------------------------------------*/
 /* lib/src/tux64/endian.h - Header for endian functions.                      */
@@ -39,6 +39,31 @@ tux64_endian_convert_copy(
    Tux64UInt32 bytes,
    enum Tux64EndianFormat format
 );
+
+/*----------------------------------------------------------------------------*/
+/* Converts an array of 'elements' integers, each 'bytes_per_element' bytes   */
+/* long, between the CPU's native endian format and the target endian format. */
+/* Unlike the above, each element is converted on its own instead of the      */
+/* whole buffer being treated as one integer.  The data doesn't need to be    */
+/* aligned, and 2, 4 and 8-byte elements are converted in bulk, so prefer     */
+/* these over converting one integer at a time in a loop.                     */
+/*----------------------------------------------------------------------------*/
+void
+tux64_endian_convert_array_inplace(
+   Tux64UInt8 * data,
+   Tux64UInt32 elements,
+   Tux64UInt32 bytes_per_element,
+   enum Tux64EndianFormat format
+);
+void
+tux64_endian_convert_array_copy(
+   Tux64UInt8 * restrict output,
+   const Tux64UInt8 * restrict data,
+   Tux64UInt32 elements,
+   Tux64UInt32 bytes_per_element,
+   enum Tux64EndianFormat format
+);
+
 Tux64UInt16
 tux64_endian_convert_uint16(
    Tux64UInt16 value,
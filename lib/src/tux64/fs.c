@@ -5,6 +5,10 @@
 /* lib/src/tux64/fs.c - Implementations for filesystem functions.             */
 /*----------------------------------------------------------------------------*/
 
+/* we compile as strict C99, so the POSIX file APIs have to be requested */
+/* explicitly.  this must come before any system headers are included. */
+#define _POSIX_C_SOURCE 200809L
+
 #include "tux64/tux64.h"
 #include "tux64/fs.h"
 
@@ -17,6 +21,13 @@
 #include <stdio.h>
 #include <errno.h>
 
+#if _TUX64_FS_POSIX_ENABLE
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif /* _TUX64_FS_POSIX_ENABLE */
+
 static struct Tux64FsResult
 tux64_fs_errno_to_fs_result(
    int err
@@ -94,62 +105,247 @@ tux64_fs_errno_to_fs_file_load_result(
    return result;
 }
 
+struct Tux64FsStreamReaderOpenResult
+tux64_fs_stream_reader_open(
+   const char * path
+) {
+   struct Tux64FsStreamReaderOpenResult result;
+   struct Tux64FsResult fs_result;
+   FILE * file;
+
+   file = fopen(path, "r");
+   if (file == NULL) {
+      fs_result = tux64_fs_errno_to_fs_result(errno);
+      result.status = fs_result.status;
+      result.payload.err = fs_result.payload;
+      return result;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   result.payload.ok.file = file;
+   return result;
+}
+
+struct Tux64FsStreamReadResult
+tux64_fs_stream_reader_read(
+   struct Tux64FsStreamReader * reader,
+   Tux64UInt8 * buffer,
+   Tux64UInt32 bytes
+) {
+   struct Tux64FsStreamReadResult result;
+   struct Tux64FsResult fs_result;
+   Tux64UInt32 read_bytes;
+
+   /* fread() keeps reading until it either has everything or hits the end */
+   /* of the file, so there's no need to loop here. */
+   read_bytes = (Tux64UInt32)fread(
+      buffer,
+      (size_t)sizeof(Tux64UInt8),
+      (size_t)bytes,
+      reader->file
+   );
+   if (ferror(reader->file) != 0) {
+      fs_result = tux64_fs_errno_to_fs_result(errno);
+      result.status = fs_result.status;
+      result.payload.err = fs_result.payload;
+      return result;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   result.payload.ok.bytes = read_bytes;
+   return result;
+}
+
+void
+tux64_fs_stream_reader_close(
+   struct Tux64FsStreamReader * reader
+) {
+   (void)fclose(reader->file);
+   return;
+}
+
+struct Tux64FsStreamWriterOpenResult
+tux64_fs_stream_writer_open(
+   const char * path
+) {
+   struct Tux64FsStreamWriterOpenResult result;
+   struct Tux64FsResult fs_result;
+   FILE * file;
+
+   file = fopen(path, "w");
+   if (file == NULL) {
+      fs_result = tux64_fs_errno_to_fs_result(errno);
+      result.status = fs_result.status;
+      result.payload.err = fs_result.payload;
+      return result;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   result.payload.ok.file = file;
+   return result;
+}
+
+struct Tux64FsResult
+tux64_fs_stream_writer_write(
+   struct Tux64FsStreamWriter * writer,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes
+) {
+   struct Tux64FsResult result;
+   Tux64UInt32 written_bytes;
+
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      written_bytes = (Tux64UInt32)fwrite(
+         data,
+         (size_t)sizeof(Tux64UInt8),
+         (size_t)bytes,
+         writer->file
+      );
+      if (ferror(writer->file) != 0) {
+         result = tux64_fs_errno_to_fs_result(errno);
+         return result;
+      }
+
+      data += written_bytes;
+      bytes -= written_bytes;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   return result;
+}
+
+struct Tux64FsResult
+tux64_fs_stream_writer_close(
+   struct Tux64FsStreamWriter * writer
+) {
+   struct Tux64FsResult result;
+
+   /* buffered writes are only flushed here, so this is where we find out */
+   /* about things like running out of disk space. */
+   if (fclose(writer->file) != 0) {
+      result = tux64_fs_errno_to_fs_result(errno);
+      return result;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   return result;
+}
+
 static struct Tux64FsFileLoadResult
 tux64_fs_file_load_allocated(
-   FILE * file,
+   struct Tux64FsStreamReader * reader,
    Tux64UInt8 * read_buffer,
    Tux64UInt32 read_bytes_total
 ) {
    struct Tux64FsFileLoadResult result;
-   Tux64UInt8 * iter_read_buffer;
-   Tux64UInt32 read_bytes_remaining;
-   Tux64UInt32 read_bytes;
+   struct Tux64FsStreamReadResult read_result;
 
-   iter_read_buffer = read_buffer;
-   read_bytes_remaining = read_bytes_total;
+   read_result = tux64_fs_stream_reader_read(reader, read_buffer, read_bytes_total);
+   if (read_result.status != TUX64_FS_STATUS_OK) {
+      result.status = read_result.status;
+      result.payload.err = read_result.payload.err;
+      return result;
+   }
 
-   while (read_bytes_remaining != TUX64_LITERAL_UINT32(0u)) {
-      read_bytes = (Tux64UInt32)fread(
-         iter_read_buffer,
-         (size_t)sizeof(Tux64UInt8),
-         read_bytes_remaining,
-         file
+   /* the file may have shrunk since we measured it */
+   result.status = TUX64_FS_STATUS_OK;
+   result.payload.ok.data = read_buffer;
+   result.payload.ok.bytes = read_result.payload.ok.bytes;
+   result.payload.ok.mapped = TUX64_BOOLEAN_FALSE;
+   return result;
+}
+
+/* the first chunk read from a stream of unknown length.  after this, the */
+/* buffer doubles in size every time it fills up. */
+#define TUX64_FS_FILE_LOAD_UNSIZED_CHUNK_BYTES\
+   (0x10000u)
+
+static struct Tux64FsFileLoadResult
+tux64_fs_file_load_unsized(
+   struct Tux64FsStreamReader * reader
+) {
+   struct Tux64FsFileLoadResult result;
+   struct Tux64FsStreamReadResult read_result;
+   Tux64UInt8 * read_buffer;
+   Tux64UInt8 * read_buffer_grown;
+   Tux64UInt32 read_buffer_capacity;
+   Tux64UInt32 read_bytes_total;
+   Tux64UInt32 read_bytes_requested;
+
+   read_buffer = TUX64_NULLPTR;
+   read_buffer_capacity = TUX64_LITERAL_UINT32(0u);
+   read_bytes_total = TUX64_LITERAL_UINT32(0u);
+
+   do {
+      if (read_bytes_total == read_buffer_capacity) {
+         if (read_buffer_capacity == TUX64_LITERAL_UINT32(TUX64_UINT32_MAX)) {
+            free(read_buffer);
+            result.status = TUX64_FS_STATUS_OUT_OF_MEMORY;
+            return result;
+         }
+
+         if (read_buffer_capacity == TUX64_LITERAL_UINT32(0u)) {
+            read_buffer_capacity = TUX64_LITERAL_UINT32(TUX64_FS_FILE_LOAD_UNSIZED_CHUNK_BYTES);
+         } else if (read_buffer_capacity > TUX64_LITERAL_UINT32(TUX64_UINT32_MAX / 2u)) {
+            read_buffer_capacity = TUX64_LITERAL_UINT32(TUX64_UINT32_MAX);
+         } else {
+            read_buffer_capacity *= TUX64_LITERAL_UINT32(2u);
+         }
+
+         read_buffer_grown = (Tux64UInt8 *)realloc(read_buffer, (size_t)read_buffer_capacity);
+         if (read_buffer_grown == NULL) {
+            free(read_buffer);
+            result.status = TUX64_FS_STATUS_OUT_OF_MEMORY;
+            return result;
+         }
+         read_buffer = read_buffer_grown;
+      }
+
+      read_bytes_requested = read_buffer_capacity - read_bytes_total;
+
+      read_result = tux64_fs_stream_reader_read(
+         reader,
+         &read_buffer[read_bytes_total],
+         read_bytes_requested
       );
-      if (ferror(file) != 0) {
-         result = tux64_fs_errno_to_fs_file_load_result(errno);
+      if (read_result.status != TUX64_FS_STATUS_OK) {
+         free(read_buffer);
+         result.status = read_result.status;
+         result.payload.err = read_result.payload.err;
          return result;
       }
 
-      iter_read_buffer += read_bytes;
-      read_bytes_remaining -= read_bytes;
-   }
+      read_bytes_total += read_result.payload.ok.bytes;
+   } while (read_result.payload.ok.bytes == read_bytes_requested);
 
    result.status = TUX64_FS_STATUS_OK;
    result.payload.ok.data = read_buffer;
    result.payload.ok.bytes = read_bytes_total;
+   result.payload.ok.mapped = TUX64_BOOLEAN_FALSE;
    return result;
 }
 
 static struct Tux64FsFileLoadResult
 tux64_fs_file_load_open(
-   FILE * file
+   struct Tux64FsStreamReader * reader
 ) {
    struct Tux64FsFileLoadResult result;
    long read_bytes;
    Tux64UInt8 * read_buffer;
 
    /* this ridiculous code is required just to get the number of bytes in a */
-   /* file. */
-   if (fseek(file, 0, SEEK_END) != 0) {
-      result = tux64_fs_errno_to_fs_file_load_result(errno);
-      return result;
+   /* file.  pipes and the like can't seek, so we have no idea how long they */
+   /* are until we reach the end. */
+   if (fseek(reader->file, 0, SEEK_END) != 0) {
+      clearerr(reader->file);
+      return tux64_fs_file_load_unsized(reader);
    }
-   read_bytes = ftell(file);
+   read_bytes = ftell(reader->file);
    if (read_bytes < 0) {
       result = tux64_fs_errno_to_fs_file_load_result(errno);
       return result;
    }
-   rewind(file);
+   rewind(reader->file);
 
    /* now we check for differing types to overflow since everything is */
    /* incompatible and of non-standard size */
@@ -176,7 +372,7 @@ tux64_fs_file_load_open(
    /* and we continue to actually loading the file, freeing the bullshit */
    /* if we encounter an error.  so basically we implement errdefer from zig. */
    result = tux64_fs_file_load_allocated(
-      file,
+      reader,
       read_buffer,
       (Tux64UInt32)read_bytes
    );
@@ -191,46 +387,286 @@ tux64_fs_file_load(
    const char * path
 ) {
    struct Tux64FsFileLoadResult result;
-   FILE * f;
+   struct Tux64FsStreamReaderOpenResult open_result;
+
+   open_result = tux64_fs_stream_reader_open(path);
+   if (open_result.status != TUX64_FS_STATUS_OK) {
+      result.status = open_result.status;
+      result.payload.err = open_result.payload.err;
+      return result;
+   }
+
+   result = tux64_fs_file_load_open(&open_result.payload.ok);
+   tux64_fs_stream_reader_close(&open_result.payload.ok);
+   return result;
+}
+
+struct Tux64FsResult
+tux64_fs_file_save(
+   const char * path,
+   const struct Tux64FsLoadedFile * file
+) {
+   struct Tux64FsResult result;
+   struct Tux64FsResult close_result;
+   struct Tux64FsStreamWriterOpenResult open_result;
+
+   open_result = tux64_fs_stream_writer_open(path);
+   if (open_result.status != TUX64_FS_STATUS_OK) {
+      result.status = open_result.status;
+      result.payload = open_result.payload.err;
+      return result;
+   }
+
+   result = tux64_fs_stream_writer_write(&open_result.payload.ok, file->data, file->bytes);
+
+   /* still report errors from closing, such as running out of disk space */
+   close_result = tux64_fs_stream_writer_close(&open_result.payload.ok);
+   if (result.status == TUX64_FS_STATUS_OK) {
+      result = close_result;
+   }
+
+   return result;
+}
+
+void
+tux64_fs_file_unload(
+   struct Tux64FsLoadedFile * file
+) {
+   free(file->data);
+   return;
+}
+
+#if _TUX64_FS_POSIX_ENABLE
+/*----------------------------------------------------------------------------*/
+
+/* 'mappable' is set to false if the file can be read, but not mapped, in */
+/* which case an empty file is returned and should be ignored. */
+static struct Tux64FsFileLoadResult
+tux64_fs_file_map_open(
+   int fd,
+   Tux64Boolean * mappable
+) {
+   struct Tux64FsFileLoadResult result;
+   struct Tux64FsResult fs_result;
+   struct stat info;
+   void * data;
+
+   /* errors only overwrite part of the payload, so the whole payload is */
+   /* initialized up front. */
+   result.status = TUX64_FS_STATUS_OK;
+   result.payload.ok.data = TUX64_NULLPTR;
+   result.payload.ok.bytes = TUX64_LITERAL_UINT32(0u);
+   result.payload.ok.mapped = TUX64_BOOLEAN_FALSE;
+
+   if (fstat(fd, &info) != 0) {
+      fs_result = tux64_fs_errno_to_fs_result(errno);
+      result.status = fs_result.status;
+      result.payload.err = fs_result.payload;
+      return result;
+   }
+
+   /* unlike fopen(), open() is perfectly happy to open a directory */
+   if (S_ISDIR(info.st_mode)) {
+      result.status = TUX64_FS_STATUS_NOT_A_FILE;
+      return result;
+   }
+
+   /* pipes, character devices and the like have no length to map */
+   if (!S_ISREG(info.st_mode)) {
+      *mappable = TUX64_BOOLEAN_FALSE;
+      return result;
+   }
+
+   if ((Tux64UInt64)info.st_size > (Tux64UInt64)TUX64_UINT32_MAX) {
+      result.status = TUX64_FS_STATUS_OUT_OF_MEMORY;
+      return result;
+   }
+
+   /* mmap() refuses to create empty mappings, but there's nothing to map */
+   /* anyways. */
+   if (info.st_size == 0) {
+      result.status = TUX64_FS_STATUS_OK;
+      result.payload.ok.data = TUX64_NULLPTR;
+      result.payload.ok.bytes = TUX64_LITERAL_UINT32(0u);
+      result.payload.ok.mapped = TUX64_BOOLEAN_TRUE;
+      return result;
+   }
+
+   data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   if (data == MAP_FAILED) {
+      /* some filesystems don't support memory-mapping at all */
+      if (errno == ENODEV) {
+         *mappable = TUX64_BOOLEAN_FALSE;
+         return result;
+      }
+
+      fs_result = tux64_fs_errno_to_fs_result(errno);
+      result.status = fs_result.status;
+      result.payload.err = fs_result.payload;
+      return result;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   result.payload.ok.data = (Tux64UInt8 *)data;
+   result.payload.ok.bytes = (Tux64UInt32)info.st_size;
+   result.payload.ok.mapped = TUX64_BOOLEAN_TRUE;
+   return result;
+}
+
+struct Tux64FsFileLoadResult
+tux64_fs_file_map(
+   const char * path
+) {
+   struct Tux64FsFileLoadResult result;
+   struct Tux64FsStreamReader reader;
+   Tux64Boolean mappable;
+   int fd;
 
-   f = fopen(path, "r");
-   if (f == NULL) {
+   fd = open(path, O_RDONLY);
+   if (fd < 0) {
       result = tux64_fs_errno_to_fs_file_load_result(errno);
       return result;
    }
 
-   result = tux64_fs_file_load_open(f);
-   (void)fclose(f);
+   /* the mapping stays valid after the file descriptor is closed */
+   mappable = TUX64_BOOLEAN_TRUE;
+   result = tux64_fs_file_map_open(fd, &mappable);
+   if (mappable == TUX64_BOOLEAN_TRUE) {
+      (void)close(fd);
+      return result;
+   }
+
+   /* we reuse the file descriptor instead of opening the path again, since */
+   /* a pipe may not be able to be opened twice. */
+   reader.file = fdopen(fd, "r");
+   if (reader.file == NULL) {
+      result = tux64_fs_errno_to_fs_file_load_result(errno);
+      (void)close(fd);
+      return result;
+   }
+
+   result = tux64_fs_file_load_open(&reader);
+   tux64_fs_stream_reader_close(&reader);
    return result;
 }
 
-static struct Tux64FsResult
-tux64_fs_file_save_open(
-   FILE * file_dest,
-   const struct Tux64FsLoadedFile * file_src
+void
+tux64_fs_file_unmap(
+   struct Tux64FsLoadedFile * file
+) {
+   if (file->mapped == TUX64_BOOLEAN_FALSE) {
+      tux64_fs_file_unload(file);
+      return;
+   }
+
+   if (file->bytes != TUX64_LITERAL_UINT32(0u)) {
+      (void)munmap(file->data, (size_t)file->bytes);
+   }
+
+   return;
+}
+
+struct Tux64FsResult
+tux64_fs_file_stamp(
+   const char * path,
+   struct Tux64FsFileStamp * output
 ) {
    struct Tux64FsResult result;
-   const Tux64UInt8 * iter_write_buffer;
-   Tux64UInt32 write_bytes_remaining;
-   Tux64UInt32 written_bytes;
+   struct stat info;
 
-   iter_write_buffer = file_src->data;
-   write_bytes_remaining = file_src->bytes;
+   if (stat(path, &info) != 0) {
+      result = tux64_fs_errno_to_fs_result(errno);
+      return result;
+   }
+
+   if (!S_ISREG(info.st_mode)) {
+      result.status = TUX64_FS_STATUS_NOT_A_FILE;
+      return result;
+   }
+
+   output->device                = (Tux64UInt64)info.st_dev;
+   output->inode                 = (Tux64UInt64)info.st_ino;
+   output->bytes                 = (Tux64UInt64)info.st_size;
+   output->modified_seconds      = (Tux64UInt64)info.st_mtim.tv_sec;
+   output->modified_nanoseconds  = (Tux64UInt64)info.st_mtim.tv_nsec;
+
+   result.status = TUX64_FS_STATUS_OK;
+   return result;
+}
+
+static struct Tux64FsWriterOpenResult
+tux64_fs_writer_open_flags(
+   const char * path,
+   Tux64UInt32 bytes,
+   int flags
+) {
+   struct Tux64FsWriterOpenResult result;
+   struct Tux64FsResult fs_result;
+   int fd;
+
+   fd = open(path, O_WRONLY | flags, 0666);
+   if (fd < 0) {
+      fs_result = tux64_fs_errno_to_fs_result(errno);
+      result.status = fs_result.status;
+      result.payload.err = fs_result.payload;
+      return result;
+   }
+
+   /* growing the file with ftruncate() instead of writing zeroes lets the */
+   /* filesystem store unwritten regions as holes. */
+   if (ftruncate(fd, (off_t)bytes) != 0) {
+      fs_result = tux64_fs_errno_to_fs_result(errno);
+      (void)close(fd);
+      result.status = fs_result.status;
+      result.payload.err = fs_result.payload;
+      return result;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   result.payload.ok.fd = fd;
+   return result;
+}
+
+struct Tux64FsWriterOpenResult
+tux64_fs_writer_open(
+   const char * path,
+   Tux64UInt32 bytes
+) {
+   return tux64_fs_writer_open_flags(path, bytes, O_CREAT | O_TRUNC);
+}
+
+struct Tux64FsWriterOpenResult
+tux64_fs_writer_open_existing(
+   const char * path,
+   Tux64UInt32 bytes
+) {
+   return tux64_fs_writer_open_flags(path, bytes, 0);
+}
+
+struct Tux64FsResult
+tux64_fs_writer_write(
+   const struct Tux64FsWriter * writer,
+   Tux64UInt32 offset,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes
+) {
+   struct Tux64FsResult result;
+   ssize_t written_bytes;
+
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      written_bytes = pwrite(writer->fd, data, (size_t)bytes, (off_t)offset);
+      if (written_bytes < 0) {
+         if (errno == EINTR) {
+            continue;
+         }
 
-   while (write_bytes_remaining != TUX64_LITERAL_UINT32(0u)) {
-      written_bytes = fwrite(
-         iter_write_buffer,
-         (size_t)sizeof(Tux64UInt8),
-         write_bytes_remaining,
-         file_dest
-      );
-      if (ferror(file_dest) != 0) {
          result = tux64_fs_errno_to_fs_result(errno);
          return result;
       }
 
-      iter_write_buffer += written_bytes;
-      write_bytes_remaining -= written_bytes;
+      data += written_bytes;
+      offset += (Tux64UInt32)written_bytes;
+      bytes -= (Tux64UInt32)written_bytes;
    }
 
    result.status = TUX64_FS_STATUS_OK;
@@ -238,32 +674,42 @@ tux64_fs_file_save_open(
 }
 
 struct Tux64FsResult
-tux64_fs_file_save(
-   const char * path,
-   const struct Tux64FsLoadedFile * file
+tux64_fs_writer_close(
+   struct Tux64FsWriter * writer
 ) {
    struct Tux64FsResult result;
-   FILE * file_dest;
 
-   file_dest = fopen(path, "w");
-   if (file_dest != NULL) {
-      result = tux64_fs_file_save_open(file_dest, file);
-      (void)fclose(file_dest);
+   if (close(writer->fd) != 0) {
+      result = tux64_fs_errno_to_fs_result(errno);
       return result;
    }
 
-   result = tux64_fs_errno_to_fs_result(errno);
+   result.status = TUX64_FS_STATUS_OK;
    return result;
 }
 
+/*----------------------------------------------------------------------------*/
+#else /* _TUX64_FS_POSIX_ENABLE */
+/*----------------------------------------------------------------------------*/
+
+struct Tux64FsFileLoadResult
+tux64_fs_file_map(
+   const char * path
+) {
+   return tux64_fs_file_load(path);
+}
+
 void
-tux64_fs_file_unload(
+tux64_fs_file_unmap(
    struct Tux64FsLoadedFile * file
 ) {
-   free(file->data);
+   tux64_fs_file_unload(file);
    return;
 }
 
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_FS_POSIX_ENABLE */
+
 void
 tux64_fs_log_result(
    const struct Tux64FsResult * result
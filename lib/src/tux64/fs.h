@@ -13,10 +13,14 @@
 
 #define _TUX64_FS_ENABLE\
    (TUX64_HAVE_STDLIB_H && TUX64_HAVE_STDIO_H && TUX64_HAVE_ERRNO_H)
+#define _TUX64_FS_POSIX_ENABLE\
+   (_TUX64_FS_ENABLE && TUX64_HAVE_FCNTL_H && TUX64_HAVE_UNISTD_H && TUX64_HAVE_SYS_STAT_H && TUX64_HAVE_SYS_MMAN_H)
 
 #if _TUX64_FS_ENABLE
 /*----------------------------------------------------------------------------*/
 
+#include <stdio.h>
+
 enum Tux64FsStatus {
    TUX64_FS_STATUS_OK,
    TUX64_FS_STATUS_NOT_FOUND,
@@ -39,9 +43,12 @@ struct Tux64FsResult {
    union Tux64FsPayload payload;
 };
 
+/* 'mapped' is only used by tux64_fs_file_unmap() to tell whether the data */
+/* was memory-mapped or loaded as a fallback. */
 struct Tux64FsLoadedFile {
    Tux64UInt8 * data;
    Tux64UInt32 bytes;
+   Tux64Boolean mapped;
 };
 
 union Tux64FsFileLoadPayload {
@@ -55,8 +62,9 @@ struct Tux64FsFileLoadResult {
 };
 
 /*----------------------------------------------------------------------------*/
-/* Attempts to load a file into memory from the given path.  The file must be */
-/* freed using tux64_fs_file_unload() once no longer needed.                  */
+/* Attempts to load a file into memory from the given path.  Pipes and other  */
+/* streams whose length isn't known ahead of time are read until they end.    */
+/* The file must be freed using tux64_fs_file_unload() once no longer needed. */
 /*----------------------------------------------------------------------------*/
 struct Tux64FsFileLoadResult
 tux64_fs_file_load(
@@ -80,6 +88,216 @@ tux64_fs_file_unload(
    struct Tux64FsLoadedFile * file
 );
 
+/*----------------------------------------------------------------------------*/
+/* Attempts to memory-map a file read-only from the given path.  Pages are    */
+/* only read from disk once they're accessed, so this is preferred over       */
+/* tux64_fs_file_load() for large files.  If the file can't be mapped, such   */
+/* as with a pipe, or the platform doesn't support memory-mapping, the file   */
+/* is loaded with tux64_fs_file_load() instead.  The file's data must not be  */
+/* modified, and the file must be unmapped using tux64_fs_file_unmap() once   */
+/* no longer needed.                                                          */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsFileLoadResult
+tux64_fs_file_map(
+   const char * path
+);
+
+/*----------------------------------------------------------------------------*/
+/* Unmaps or frees a file from tux64_fs_file_map().                           */
+/*----------------------------------------------------------------------------*/
+void
+tux64_fs_file_unmap(
+   struct Tux64FsLoadedFile * file
+);
+
+struct Tux64FsStreamReader {
+   FILE * file;
+};
+
+union Tux64FsStreamReaderOpenPayload {
+   struct Tux64FsStreamReader ok;
+   union Tux64FsPayload err;
+};
+
+struct Tux64FsStreamReaderOpenResult {
+   enum Tux64FsStatus status;
+   union Tux64FsStreamReaderOpenPayload payload;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to open the file at the given path to be read in order, one chunk */
+/* at a time.  Unlike loading or mapping, this works with any kind of stream  */
+/* and only ever holds one chunk in memory.  The reader must be closed using  */
+/* tux64_fs_stream_reader_close().                                            */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsStreamReaderOpenResult
+tux64_fs_stream_reader_open(
+   const char * path
+);
+
+struct Tux64FsStreamReadPayloadOk {
+   Tux64UInt32 bytes;
+};
+
+union Tux64FsStreamReadPayload {
+   struct Tux64FsStreamReadPayloadOk ok;
+   union Tux64FsPayload err;
+};
+
+struct Tux64FsStreamReadResult {
+   enum Tux64FsStatus status;
+   union Tux64FsStreamReadPayload payload;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to read the next 'bytes' bytes into 'buffer'.  Fewer bytes are    */
+/* only read once the end of the file is reached, after which every read      */
+/* returns zero bytes.                                                        */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsStreamReadResult
+tux64_fs_stream_reader_read(
+   struct Tux64FsStreamReader * reader,
+   Tux64UInt8 * buffer,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+/* Closes a reader opened with tux64_fs_stream_reader_open().                 */
+/*----------------------------------------------------------------------------*/
+void
+tux64_fs_stream_reader_close(
+   struct Tux64FsStreamReader * reader
+);
+
+struct Tux64FsStreamWriter {
+   FILE * file;
+};
+
+union Tux64FsStreamWriterOpenPayload {
+   struct Tux64FsStreamWriter ok;
+   union Tux64FsPayload err;
+};
+
+struct Tux64FsStreamWriterOpenResult {
+   enum Tux64FsStatus status;
+   union Tux64FsStreamWriterOpenPayload payload;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to create or truncate the file at the given path to be written in */
+/* order, one chunk at a time.  Unlike tux64_fs_writer_open(), the length     */
+/* doesn't need to be known ahead of time and the file may be a pipe.  The    */
+/* writer must be closed using tux64_fs_stream_writer_close().                */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsStreamWriterOpenResult
+tux64_fs_stream_writer_open(
+   const char * path
+);
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to write 'bytes' bytes from 'data' after everything written so    */
+/* far.  Writes may be buffered until the writer is closed.                   */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsResult
+tux64_fs_stream_writer_write(
+   struct Tux64FsStreamWriter * writer,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+/* Closes the writer, returning any error from flushing buffered writes.  The */
+/* writer is always closed, even if an error is returned.                     */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsResult
+tux64_fs_stream_writer_close(
+   struct Tux64FsStreamWriter * writer
+);
+
+#if _TUX64_FS_POSIX_ENABLE
+/*----------------------------------------------------------------------------*/
+
+struct Tux64FsFileStamp {
+   Tux64UInt64 device;
+   Tux64UInt64 inode;
+   Tux64UInt64 bytes;
+   Tux64UInt64 modified_seconds;
+   Tux64UInt64 modified_nanoseconds;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to read the identity, length and modification time of the file    */
+/* at the given path without reading its contents.  If two stamps of the same */
+/* path compare equal, the file can be assumed to be unchanged.  Stamps have  */
+/* no padding, so they can be compared and stored as raw bytes.               */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsResult
+tux64_fs_file_stamp(
+   const char * path,
+   struct Tux64FsFileStamp * output
+);
+
+struct Tux64FsWriter {
+   int fd;
+};
+
+union Tux64FsWriterOpenPayload {
+   struct Tux64FsWriter ok;
+   union Tux64FsPayload err;
+};
+
+struct Tux64FsWriterOpenResult {
+   enum Tux64FsStatus status;
+   union Tux64FsWriterOpenPayload payload;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to create or truncate the file at the given path and resize it    */
+/* to 'bytes' bytes.  Any bytes which are never written read back as zeroes,  */
+/* and are stored as holes on filesystems which support sparse files.  The    */
+/* writer must be closed using tux64_fs_writer_close().                       */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsWriterOpenResult
+tux64_fs_writer_open(
+   const char * path,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+/* Same as tux64_fs_writer_open(), except the file must already exist and its */
+/* contents are kept.  If the file grows, the new bytes read back as zeroes,  */
+/* and if the file shrinks, any bytes past the end are discarded.             */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsWriterOpenResult
+tux64_fs_writer_open_existing(
+   const char * path,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+/* Attempts to write 'bytes' bytes from 'data' at 'offset' in the file.       */
+/* Writes may be done in any order.                                           */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsResult
+tux64_fs_writer_write(
+   const struct Tux64FsWriter * writer,
+   Tux64UInt32 offset,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes
+);
+
+/*----------------------------------------------------------------------------*/
+/* Closes the writer, returning any error which was deferred until now.  The  */
+/* writer is always closed, even if an error is returned.                     */
+/*----------------------------------------------------------------------------*/
+struct Tux64FsResult
+tux64_fs_writer_close(
+   struct Tux64FsWriter * writer
+);
+
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_FS_POSIX_ENABLE */
+
 /*----------------------------------------------------------------------------*/
 /* Formats and logs 'result' to the console.  Assumes result->status is never */
 /* TUX64_FS_STATUS_OK.                                                        */
@@ -28,6 +28,48 @@
 /*----------------------------------------------------------------------------*/
 #endif /* TUX64_HAVE_STRING_H */
 
+/* the fallbacks move data a word at a time wherever both sides can be */
+/* aligned at once.  accessing memory through this type is allowed to alias */
+/* anything, same as through a char pointer. */
+typedef Tux64UInt64 __attribute__((may_alias)) Tux64MemoryWord;
+
+#define TUX64_MEMORY_WORD_BYTES\
+   (sizeof(Tux64MemoryWord))
+
+/* below this, aligning the pointers costs more than using words saves */
+#define TUX64_MEMORY_WORD_THRESHOLD_BYTES\
+   (2u * TUX64_MEMORY_WORD_BYTES)
+
+/* the number of words moved per iteration of the unrolled loops */
+#define TUX64_MEMORY_WORD_UNROLL\
+   (4u)
+
+/* in freestanding builds, memcpy() and memset() end up calling the */
+/* fallbacks, so the compiler must not turn their loops back into calls to */
+/* memcpy() and memset(), otherwise they recurse forever. */
+#define TUX64_MEMORY_FALLBACK_LOOP\
+   __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+static Tux64Boolean
+tux64_memory_words_usable(
+   const void * lhs,
+   const void * rhs,
+   Tux64UInt32 bytes
+) {
+   if (bytes < TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_THRESHOLD_BYTES)) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return ((((Tux64UIntPtr)lhs ^ (Tux64UIntPtr)rhs) % TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES)) == TUX64_LITERAL_UINT32(0u));
+}
+
+static Tux64UInt32
+tux64_memory_words_head_bytes(
+   const void * ptr
+) {
+   return (TUX64_LITERAL_UINT32(0u) - (Tux64UInt32)(Tux64UIntPtr)ptr) % TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES);
+}
+
 #if TUX64_HAVE_STRING_H
 /*----------------------------------------------------------------------------*/
 
@@ -77,6 +119,63 @@ tux64_memory_libc_move_wrapper(
 /*----------------------------------------------------------------------------*/
 #endif /* TUX64_HAVE_STRING_H */
 
+TUX64_MEMORY_FALLBACK_LOOP
+static void
+tux64_memory_copy_fallback_bytes(
+   Tux64UInt8 * restrict iter_dest,
+   const Tux64UInt8 * restrict iter_src,
+   Tux64UInt32 bytes
+) {
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      *iter_dest = *iter_src;
+
+      iter_dest++;
+      iter_src++;
+      bytes--;
+   }
+
+   return;
+}
+
+TUX64_MEMORY_FALLBACK_LOOP
+static void
+tux64_memory_copy_fallback_words(
+   Tux64MemoryWord * restrict iter_dest,
+   const Tux64MemoryWord * restrict iter_src,
+   Tux64UInt32 words
+) {
+   Tux64MemoryWord word0;
+   Tux64MemoryWord word1;
+   Tux64MemoryWord word2;
+   Tux64MemoryWord word3;
+
+   /* all the loads are issued before the stores so they can overlap */
+   while (words >= TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_UNROLL)) {
+      word0 = iter_src[0u];
+      word1 = iter_src[1u];
+      word2 = iter_src[2u];
+      word3 = iter_src[3u];
+      iter_dest[0u] = word0;
+      iter_dest[1u] = word1;
+      iter_dest[2u] = word2;
+      iter_dest[3u] = word3;
+
+      iter_dest += TUX64_MEMORY_WORD_UNROLL;
+      iter_src += TUX64_MEMORY_WORD_UNROLL;
+      words -= TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_UNROLL);
+   }
+
+   while (words != TUX64_LITERAL_UINT32(0u)) {
+      *iter_dest = *iter_src;
+
+      iter_dest++;
+      iter_src++;
+      words--;
+   }
+
+   return;
+}
+
 static void
 tux64_memory_copy_fallback(
    void * restrict dest,
@@ -85,17 +184,33 @@ tux64_memory_copy_fallback(
 ) {
    Tux64UInt8 * restrict iter_dest;
    const Tux64UInt8 * restrict iter_src;
+   Tux64UInt32 bytes_head;
+   Tux64UInt32 bytes_body;
 
    iter_dest = dest;
    iter_src = src;
-   while (bytes != TUX64_LITERAL_UINT32(0u)) {
-      *iter_dest = *iter_src;
 
-      iter_dest++;
-      iter_src++;
-      bytes--;
+   if (tux64_memory_words_usable(dest, src, bytes) == TUX64_BOOLEAN_FALSE) {
+      tux64_memory_copy_fallback_bytes(iter_dest, iter_src, bytes);
+      return;
    }
 
+   bytes_head = tux64_memory_words_head_bytes(dest);
+   bytes_body = (bytes - bytes_head) & ~TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES - 1u);
+
+   tux64_memory_copy_fallback_bytes(iter_dest, iter_src, bytes_head);
+   iter_dest += bytes_head;
+   iter_src += bytes_head;
+
+   tux64_memory_copy_fallback_words(
+      (Tux64MemoryWord *)iter_dest,
+      (const Tux64MemoryWord *)iter_src,
+      bytes_body / TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES)
+   );
+   iter_dest += bytes_body;
+   iter_src += bytes_body;
+
+   tux64_memory_copy_fallback_bytes(iter_dest, iter_src, bytes - bytes_head - bytes_body);
    return;
 }
 
@@ -134,86 +249,43 @@ tux64_memory_copy(
    return;
 }
 
+TUX64_MEMORY_FALLBACK_LOOP
 static void
-tux64_memory_move_fallback_leftward(
-   void * dest,
-   const void * src,
-   Tux64UInt32 bytes,
-   Tux64UInt32 bytes_overlap
+tux64_memory_move_fallback_bytes_leftward(
+   Tux64UInt8 * iter_dest,
+   const Tux64UInt8 * iter_src,
+   Tux64UInt32 bytes
 ) {
-   Tux64UInt8 * iter_dest;
-   const Tux64UInt8 * iter_src;
-
-   /*----------------------------------------------------*/
-   /*                                                    */
-   /*   dest             src                             */
-   /*    |                |                              */
-   /*    x----------------|xxxx|----------------x        */
-   /*    |                |xxxx|                |        */
-   /*    x----------------|xxxx|----------------x        */
-   /*    \____________________/                          */
-   /*               |                                    */
-   /*               n                                    */
-   /*                                                    */
-   /*----------------------------------------------------*/
-
-   iter_dest = dest;
-   iter_src = src;
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      *iter_dest = *iter_src;
 
-   /* we have to do a byte-for-byte copy here because it's not a guarantee */
-   /* that we have enough memory between dest and src for a straight memcpy. */
-   do {
-      *iter_dest++ = *iter_src++;
-      bytes_overlap--;
+      iter_dest++;
+      iter_src++;
       bytes--;
-   } while (bytes_overlap != TUX64_LITERAL_UINT32(0u));
-
-   /* overlapping region is taken care of, we can now memcpy. */
-   tux64_memory_copy(iter_dest, iter_src, bytes);
+   }
 
    return;
 }
 
+TUX64_MEMORY_FALLBACK_LOOP
 static void
-tux64_memory_move_fallback_rightward(
-   void * dest,
-   const void * src,
-   Tux64UInt32 bytes,
-   Tux64UInt32 bytes_overlap
+tux64_memory_move_fallback_bytes_rightward(
+   Tux64UInt8 * iter_dest,
+   const Tux64UInt8 * iter_src,
+   Tux64UInt32 bytes
 ) {
-   Tux64UInt8 * iter_dest;
-   const Tux64UInt8 * iter_src;
+   iter_dest += bytes;
+   iter_src += bytes;
 
-   /*----------------------------------------------------*/
-   /*                                                    */
-   /*   src             dest                             */
-   /*    |                |                              */
-   /*    x----------------|xxxx|----------------x        */
-   /*    |                |xxxx|                |        */
-   /*    x----------------|xxxx|----------------x        */
-   /*    \____________________/                          */
-   /*               |                                    */
-   /*               n                                    */
-   /*                                                    */
-   /*----------------------------------------------------*/
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      iter_dest--;
+      iter_src--;
 
-   iter_dest = dest;
-   iter_src = src;
+      *iter_dest = *iter_src;
 
-   /* byte-for-byte copy same as above, but reverse loops since src has the */
-   /* overlapping region at the end of its buffer now. */
-   iter_dest = &iter_dest[bytes - 1u];
-   iter_src = &iter_src[bytes - 1u];
-   do {
-      *iter_dest-- = *iter_src--;
-      bytes_overlap--;
       bytes--;
-   } while (bytes_overlap != TUX64_LITERAL_UINT32(0u));
+   }
 
-   /* memcpy without the use of the iterators since we set them up for */
-   /* reverse loops instead of forward loops. */
-   tux64_memory_copy(dest, src, bytes);
-   
    return;
 }
 
@@ -223,8 +295,10 @@ tux64_memory_move_fallback(
    const void * src,
    Tux64UInt32 bytes
 ) {
+   Tux64UInt8 * iter_dest;
+   const Tux64UInt8 * iter_src;
    Tux64UInt32 distance;
-   Tux64UInt32 bytes_overlap;
+   Tux64UInt32 bytes_chunk;
 
    if (dest == src) {
       return;
@@ -242,16 +316,58 @@ tux64_memory_move_fallback(
       return;
    }
 
-   /* important to do this after the above check to prevent weird behavior */
-   /* with wrapping subtraction. */
-   bytes_overlap = (bytes - distance);
+   /* when the regions are this close, every chunk below would be copied a */
+   /* byte at a time anyway, so skip the call for each one. */
+   if (distance < TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_THRESHOLD_BYTES)) {
+      if (src < dest) {
+         tux64_memory_move_fallback_bytes_rightward(dest, src, bytes);
+      } else {
+         tux64_memory_move_fallback_bytes_leftward(dest, src, bytes);
+      }
 
-   if (src < dest) {
-      tux64_memory_move_fallback_rightward(dest, src, bytes, bytes_overlap);
       return;
    }
 
-   tux64_memory_move_fallback_leftward(dest, src, bytes, bytes_overlap);
+   /* instead of falling back to bytes for the overlapping region, we move  */
+   /* 'distance' bytes at a time, starting from the end which gets clobbered */
+   /* last.  each chunk only overwrites source bytes which have already been */
+   /* moved, so the chunks themselves never overlap and can use the fast    */
+   /* copy.  visually, for a leftward move:                                 */
+   /*                                                                       */
+   /*    dest     src                                                       */
+   /*     |        |                                                        */
+   /*     [chunk 0][chunk 1][chunk 2][...]                                  */
+   /*     ^        |                                                        */
+   /*     \________/  chunk 0 is moved first, then chunk 1 on top of the    */
+   /*                 old chunk 0, and so on.                               */
+
+   iter_dest = dest;
+   iter_src = src;
+
+   if (src < dest) {
+      iter_dest += bytes;
+      iter_src += bytes;
+   }
+
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      bytes_chunk = distance;
+      if (bytes_chunk > bytes) {
+         bytes_chunk = bytes;
+      }
+
+      if (src < dest) {
+         iter_dest -= bytes_chunk;
+         iter_src -= bytes_chunk;
+         tux64_memory_copy(iter_dest, iter_src, bytes_chunk);
+      } else {
+         tux64_memory_copy(iter_dest, iter_src, bytes_chunk);
+         iter_dest += bytes_chunk;
+         iter_src += bytes_chunk;
+      }
+
+      bytes -= bytes_chunk;
+   }
+
    return;
 }
 
@@ -290,6 +406,76 @@ tux64_memory_move(
    return;
 }
 
+TUX64_MEMORY_FALLBACK_LOOP
+static void
+tux64_memory_fill_fallback_bytes(
+   Tux64UInt8 * iter_dest,
+   Tux64UInt8 byte,
+   Tux64UInt32 bytes
+) {
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      *iter_dest = byte;
+
+      iter_dest++;
+      bytes--;
+   }
+
+   return;
+}
+
+TUX64_MEMORY_FALLBACK_LOOP
+static void
+tux64_memory_fill_fallback_byte(
+   Tux64UInt8 * iter_dest,
+   Tux64UInt8 byte,
+   Tux64UInt32 bytes
+) {
+   Tux64MemoryWord * iter_dest_words;
+   Tux64MemoryWord pattern;
+   Tux64UInt32 bytes_head;
+   Tux64UInt32 words;
+
+   /* only the destination needs to be aligned, so we never have to fall */
+   /* back to bytes for the whole fill. */
+   if (bytes < TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_THRESHOLD_BYTES)) {
+      tux64_memory_fill_fallback_bytes(iter_dest, byte, bytes);
+      return;
+   }
+
+   bytes_head = tux64_memory_words_head_bytes(iter_dest);
+   tux64_memory_fill_fallback_bytes(iter_dest, byte, bytes_head);
+   iter_dest += bytes_head;
+   bytes -= bytes_head;
+
+   /* 0x0101010101010101 * byte copies the byte into every lane */
+   pattern = (Tux64MemoryWord)byte * (~(Tux64MemoryWord)0u / (Tux64MemoryWord)TUX64_UINT8_MAX);
+
+   iter_dest_words = (Tux64MemoryWord *)iter_dest;
+   words = bytes / TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES);
+   while (words >= TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_UNROLL)) {
+      iter_dest_words[0u] = pattern;
+      iter_dest_words[1u] = pattern;
+      iter_dest_words[2u] = pattern;
+      iter_dest_words[3u] = pattern;
+
+      iter_dest_words += TUX64_MEMORY_WORD_UNROLL;
+      words -= TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_UNROLL);
+   }
+   while (words != TUX64_LITERAL_UINT32(0u)) {
+      *iter_dest_words = pattern;
+
+      iter_dest_words++;
+      words--;
+   }
+
+   tux64_memory_fill_fallback_bytes(
+      (Tux64UInt8 *)iter_dest_words,
+      byte,
+      bytes % TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES)
+   );
+   return;
+}
+
 static void
 tux64_memory_fill_fallback(
    void * restrict dest,
@@ -298,12 +484,36 @@ tux64_memory_fill_fallback(
    Tux64UInt32 bytes_per_element
 ) {
    Tux64UInt8 * restrict iter_dest;
+   Tux64UInt32 bytes_filled;
+   Tux64UInt32 bytes_total;
+   Tux64UInt32 bytes_chunk;
 
    iter_dest = dest;
-   while (elements != TUX64_LITERAL_UINT32(0u)) {
-      tux64_memory_copy(iter_dest, sentinel, bytes_per_element);
-      iter_dest += bytes_per_element;
-      elements--;
+
+   if (bytes_per_element == TUX64_LITERAL_UINT32(1u)) {
+      tux64_memory_fill_fallback_byte(iter_dest, *(const Tux64UInt8 * restrict)sentinel, elements);
+      return;
+   }
+
+   if (elements == TUX64_LITERAL_UINT32(0u)) {
+      return;
+   }
+
+   /* for larger elements, we copy one element in, then keep doubling the */
+   /* filled region by copying it after itself.  once the filled region is */
+   /* a multiple of the word size, every copy after it can use words. */
+   tux64_memory_copy(iter_dest, sentinel, bytes_per_element);
+
+   bytes_filled = bytes_per_element;
+   bytes_total = elements * bytes_per_element;
+   while (bytes_filled != bytes_total) {
+      bytes_chunk = bytes_total - bytes_filled;
+      if (bytes_chunk > bytes_filled) {
+         bytes_chunk = bytes_filled;
+      }
+
+      tux64_memory_copy(&iter_dest[bytes_filled], iter_dest, bytes_chunk);
+      bytes_filled += bytes_chunk;
    }
 
    return;
@@ -376,6 +586,63 @@ tux64_memory_compare(
    return tux64_memory_compare_with_equal_lengths(data_lhs, data_rhs, bytes_lhs);
 }
 
+static Tux64Boolean
+tux64_memory_compare_with_equal_lengths_fallback_bytes(
+   const Tux64UInt8 * restrict iter_data_lhs,
+   const Tux64UInt8 * restrict iter_data_rhs,
+   Tux64UInt32 bytes
+) {
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      if (*iter_data_lhs != *iter_data_rhs) {
+         return TUX64_BOOLEAN_FALSE;
+      }
+
+      iter_data_lhs++;
+      iter_data_rhs++;
+      bytes--;
+   }
+
+   return TUX64_BOOLEAN_TRUE;
+}
+
+static Tux64Boolean
+tux64_memory_compare_with_equal_lengths_fallback_words(
+   const Tux64MemoryWord * restrict iter_data_lhs,
+   const Tux64MemoryWord * restrict iter_data_rhs,
+   Tux64UInt32 words
+) {
+   Tux64MemoryWord difference;
+
+   /* we only care about equality, so the differences are merged to save a */
+   /* branch on every word. */
+   while (words >= TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_UNROLL)) {
+      difference =
+         (iter_data_lhs[0u] ^ iter_data_rhs[0u]) |
+         (iter_data_lhs[1u] ^ iter_data_rhs[1u]) |
+         (iter_data_lhs[2u] ^ iter_data_rhs[2u]) |
+         (iter_data_lhs[3u] ^ iter_data_rhs[3u]);
+      if (difference != (Tux64MemoryWord)0u) {
+         return TUX64_BOOLEAN_FALSE;
+      }
+
+      iter_data_lhs += TUX64_MEMORY_WORD_UNROLL;
+      iter_data_rhs += TUX64_MEMORY_WORD_UNROLL;
+      words -= TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_UNROLL);
+   }
+
+   while (words != TUX64_LITERAL_UINT32(0u)) {
+      if (*iter_data_lhs != *iter_data_rhs) {
+         return TUX64_BOOLEAN_FALSE;
+      }
+
+      iter_data_lhs++;
+      iter_data_rhs++;
+      words--;
+   }
+
+   return TUX64_BOOLEAN_TRUE;
+}
+
 static Tux64Boolean
 tux64_memory_compare_with_equal_lengths_fallback(
    const void * restrict data_lhs,
@@ -384,21 +651,40 @@ tux64_memory_compare_with_equal_lengths_fallback(
 ) {
    const Tux64UInt8 * restrict iter_data_lhs;
    const Tux64UInt8 * restrict iter_data_rhs;
+   Tux64UInt32 bytes_head;
+   Tux64UInt32 bytes_body;
 
    iter_data_lhs = data_lhs;
    iter_data_rhs = data_rhs;
 
-   while (bytes != TUX64_LITERAL_UINT32(0u)) {
-      if (*iter_data_lhs != *iter_data_rhs) {
-         return TUX64_BOOLEAN_FALSE;
-      }
+   if (tux64_memory_words_usable(data_lhs, data_rhs, bytes) == TUX64_BOOLEAN_FALSE) {
+      return tux64_memory_compare_with_equal_lengths_fallback_bytes(iter_data_lhs, iter_data_rhs, bytes);
+   }
 
-      iter_data_lhs++;
-      iter_data_rhs++;
-      bytes--;
+   bytes_head = tux64_memory_words_head_bytes(data_lhs);
+   bytes_body = (bytes - bytes_head) & ~TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES - 1u);
+
+   if (tux64_memory_compare_with_equal_lengths_fallback_bytes(iter_data_lhs, iter_data_rhs, bytes_head) == TUX64_BOOLEAN_FALSE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+   iter_data_lhs += bytes_head;
+   iter_data_rhs += bytes_head;
+
+   if (tux64_memory_compare_with_equal_lengths_fallback_words(
+      (const Tux64MemoryWord *)iter_data_lhs,
+      (const Tux64MemoryWord *)iter_data_rhs,
+      bytes_body / TUX64_LITERAL_UINT32(TUX64_MEMORY_WORD_BYTES)
+   ) == TUX64_BOOLEAN_FALSE) {
+      return TUX64_BOOLEAN_FALSE;
    }
+   iter_data_lhs += bytes_body;
+   iter_data_rhs += bytes_body;
 
-   return TUX64_BOOLEAN_TRUE;
+   return tux64_memory_compare_with_equal_lengths_fallback_bytes(
+      iter_data_lhs,
+      iter_data_rhs,
+      bytes - bytes_head - bytes_body
+   );
 }
 
 #if TUX64_HAVE_STRING_H
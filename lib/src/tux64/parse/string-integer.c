@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/*                          Copyright (C) Tux64 2025                          */
+/*                       Copyright (C) Tux64 2025, 2026                       */
 /*                    https://github.com/bradleycha/tux64                     */
 /*----------------------------------------------------------------------------*/
 /* lib/src/tux64/parse/string-integer.c - Implementations for string integer  */
@@ -153,3 +153,75 @@ tux64_parse_string_integer_hex_uint64(
    return result;
 }
 
+struct Tux64ParseStringIntegerResult
+tux64_parse_string_integer_decimal_uint8(
+   const struct Tux64String * string,
+   Tux64UInt8 * output
+) {
+   struct Tux64ParseStringIntegerResult result;
+   Tux64UInt64 value;
+
+   result = tux64_parse_string_integer_decimal_uint64(string, &value);
+   if (result.status != TUX64_PARSE_STRING_INTEGER_STATUS_OK) {
+      return result;
+   }
+
+   if (value > TUX64_UINT8_MAX) {
+      result.status = TUX64_PARSE_STRING_INTEGER_STATUS_OUT_OF_RANGE;
+      return result;
+   }
+
+   *output = (Tux64UInt8)value;
+   result.status = TUX64_PARSE_STRING_INTEGER_STATUS_OK;
+   return result;
+}
+
+struct Tux64ParseStringIntegerResult
+tux64_parse_string_integer_decimal_uint64(
+   const struct Tux64String * string,
+   Tux64UInt64 * output
+) {
+   struct Tux64ParseStringIntegerResult result;
+   Tux64UInt64 buffer;
+   const char * iter_string;
+   Tux64UInt32 characters_remaining;
+   char digit;
+   Tux64UInt8 decit;
+
+   buffer = TUX64_LITERAL_UINT64(0llu);
+
+   iter_string = string->ptr;
+   characters_remaining = string->characters;
+
+   while (characters_remaining != TUX64_LITERAL_UINT32(0u)) {
+      digit = *iter_string;
+
+      if (digit < '0' || digit > '9') {
+         result.status = TUX64_PARSE_STRING_INTEGER_STATUS_INVALID_DIGIT;
+         result.payload.invalid_digit.character = digit;
+         return result;
+      }
+      decit = digit - TUX64_LITERAL_UINT8('0');
+
+      /* unlike hex, we can't check bits to see if we're risking overflow, */
+      /* so we check against the largest value which won't overflow. */
+      if (
+         buffer > TUX64_UINT64_MAX / TUX64_LITERAL_UINT64(10llu) ||
+         buffer * TUX64_LITERAL_UINT64(10llu) > TUX64_UINT64_MAX - decit
+      ) {
+         result.status = TUX64_PARSE_STRING_INTEGER_STATUS_OUT_OF_RANGE;
+         return result;
+      }
+
+      buffer *= TUX64_LITERAL_UINT64(10llu);
+      buffer += decit;
+
+      iter_string++;
+      characters_remaining--;
+   }
+
+   *output = buffer;
+
+   result.status = TUX64_PARSE_STRING_INTEGER_STATUS_OK;
+   return result;
+}
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/*                          Copyright (C) Tux64 2025                          */
+/*                       Copyright (C) Tux64 2025, 2026                       */
 /*                    https://github.com/bradleycha/tux64                     */
 /*----------------------------------------------------------------------------*/
 /* lib/src/tux64/parse/string-integer.h - Header for string integer parser    */
@@ -56,5 +56,18 @@ tux64_parse_string_integer_hex_uint64(
 );
 
 /*----------------------------------------------------------------------------*/
-#endif /* _TUX64_PARSE_STRING_INTEGER_H */
+/* Parses a decimal string without any sign.                                  */
+/*----------------------------------------------------------------------------*/
+struct Tux64ParseStringIntegerResult
+tux64_parse_string_integer_decimal_uint8(
+   const struct Tux64String * string,
+   Tux64UInt8 * output
+);
+struct Tux64ParseStringIntegerResult
+tux64_parse_string_integer_decimal_uint64(
+   const struct Tux64String * string,
+   Tux64UInt64 * output
+);
 
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_PARSE_STRING_INTEGER_H */
@@ -9,7 +9,44 @@
 #include "tux64/tux64.h"
 #include "tux64/platform/mips/n64/boot.h"
 
-/* until we add any helper functions, this only exists to make sure our */
-/* static assertions get tripped during the library's build.  otherwise, we */
-/* could have broken code sneak into git commits before being caught. */
+/* besides the helper functions, this also makes sure our static assertions */
+/* get tripped during the library's build.  otherwise, we could have broken */
+/* code sneak into git commits before being caught. */
+
+Tux64UInt32
+tux64_platform_mips_n64_boot_kernel_segment_padding(
+   Tux64UInt32 packed_end,
+   Tux64UInt32 offset
+) {
+   /* the distance to the next address with the same remainder as 'offset'. */
+   /* this still works if the subtraction wraps, since 2^32 is a multiple of */
+   /* the alignment. */
+   return (offset - packed_end) % TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENT_ALIGNMENT);
+}
+
+/* "retail" matches what official cartridges use, which is useful if the ROM */
+/* header was built with a weird PI configuration.  "fast" and "turbo" are */
+/* progressively more aggressive and are only tolerated by flashcarts and */
+/* other cartridges with fast flash chips. */
+const struct Tux64PlatformMipsN64BootHeaderPiTiming
+tux64_platform_mips_n64_boot_pi_timing_profiles [TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILES_COUNT] = {
+   [TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_RETAIL] = {
+      .lat = TUX64_LITERAL_UINT8(0x40u),
+      .pwd = TUX64_LITERAL_UINT8(0x12u),
+      .pgs = TUX64_LITERAL_UINT8(0x07u),
+      .rls = TUX64_LITERAL_UINT8(0x03u)
+   },
+   [TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_FAST] = {
+      .lat = TUX64_LITERAL_UINT8(0x20u),
+      .pwd = TUX64_LITERAL_UINT8(0x0cu),
+      .pgs = TUX64_LITERAL_UINT8(0x07u),
+      .rls = TUX64_LITERAL_UINT8(0x02u)
+   },
+   [TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_TURBO] = {
+      .lat = TUX64_LITERAL_UINT8(0x05u),
+      .pwd = TUX64_LITERAL_UINT8(0x0cu),
+      .pgs = TUX64_LITERAL_UINT8(0x0du),
+      .rls = TUX64_LITERAL_UINT8(0x02u)
+   }
+};
 
@@ -32,13 +32,27 @@
    (1u << 1u)
 #define TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_NO_DELAY\
    (1u << 2u)
+#define TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING\
+   (1u << 3u)
+#define TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING_PROBE\
+   (1u << 4u)
+#define TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_STATS_DISPLAY\
+   (1u << 5u)
+#define TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_HEADLESS\
+   (1u << 6u)
+
+/*----------------------------------------------------------------------------*/
+/* The maximum number of loadable segments the kernel image may contain.      */
+/*----------------------------------------------------------------------------*/
+#define TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX\
+   (4u)
 
 /*----------------------------------------------------------------------------*/
 /* The size of the boot header, in bytes.  Also provides a version aligned    */
 /* forward to the nearest 16-byte boundary.                                   */
 /*----------------------------------------------------------------------------*/
 #define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_BYTES\
-   (0x54) /* TODO: compute this with AC_CHECK_SIZEOF(...) */
+   (0x8c) /* TODO: compute this with AC_CHECK_SIZEOF(...) */
 
 /*----------------------------------------------------------------------------*/
 /* The offset of each field in the boot header.                               */
@@ -75,8 +89,12 @@
    (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_IMAGE_MEMORY)
 #define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_ADDR_ENTRY\
    (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_ADDR_LOAD)
-#define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_CHECKSUM\
+#define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_SEGMENT_COUNT\
    (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_ADDR_ENTRY)
+#define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_SEGMENTS\
+   (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_SEGMENT_COUNT)
+#define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_CHECKSUM\
+   ((12u * TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX) + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_SEGMENTS)
 #define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_ADDR_CART\
    (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_CHECKSUM)
 #define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_LENGTH\
@@ -87,6 +105,8 @@
    (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_COMMAND_LINE_CHECKSUM)
 #define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_COMMAND_LINE_LENGTH\
    (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_COMMAND_LINE_ADDR_CART)
+#define TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_PI_TIMING\
+   (4u + TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_COMMAND_LINE_LENGTH)
 
 #if !TUX64_PREPROCESSOR_ONLY
 /*----------------------------------------------------------------------------*/
@@ -121,10 +141,27 @@ struct Tux64PlatformMipsN64BootHeaderFileBootloader {
    struct Tux64PlatformMipsN64BootHeaderFile stage2;
 };
 
+/* a single loadable segment of the kernel.  only 'length' bytes are stored */
+/* in ROM, packed after the previous segment with just enough zeroes in */
+/* between to keep the same alignment as in memory, see */
+/* tux64_platform_mips_n64_boot_kernel_segment_padding().  the remaining */
+/* 'memory - length' bytes are zeroed by the bootloader. */
+struct Tux64PlatformMipsN64BootHeaderKernelSegment {
+   /* offset relative to 'addr_load' where the segment is placed in memory */
+   Tux64UInt32 offset;
+   Tux64UInt32 length;
+   Tux64UInt32 memory;
+};
+
+/* 'image.file' describes all segments packed together, and 'image.memory' */
+/* spans from 'addr_load' to the end of the last segment in memory. */
+/* segments are sorted by 'offset' and never overlap. */
 struct Tux64PlatformMipsN64BootHeaderFileKernel {
    struct Tux64PlatformMipsN64BootHeaderExecutable image;
    Tux64UInt32 addr_load;
    Tux64UInt32 addr_entry;
+   Tux64UInt32 segment_count;
+   struct Tux64PlatformMipsN64BootHeaderKernelSegment segments [TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX];
 };
 
 struct Tux64PlatformMipsN64BootHeaderFiles {
@@ -134,12 +171,26 @@ struct Tux64PlatformMipsN64BootHeaderFiles {
    struct Tux64PlatformMipsN64BootHeaderFile command_line;
 };
 
+/* PI domain 1 bus timings applied before loading the boot files.  these are */
+/* written directly to the PI_BSD_DOM1_* registers, so each value is only */
+/* meaningful within the bit width of its respective register. */
+struct Tux64PlatformMipsN64BootHeaderPiTiming {
+   Tux64UInt8 lat;
+   Tux64UInt8 pwd;
+   Tux64UInt8 pgs;
+   Tux64UInt8 rls;
+};
+
 struct Tux64PlatformMipsN64BootHeaderData {
    /* bitflags used by various stages of the boot process */
    Tux64UInt32 flags;
 
    /* files used during the boot process */
    struct Tux64PlatformMipsN64BootHeaderFiles files;
+
+   /* PI timings, only used when TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING */
+   /* is set in 'flags' */
+   struct Tux64PlatformMipsN64BootHeaderPiTiming pi_timing;
 };
 
 /* the boot header stored after IPL3/stage-0 in ROM. */
@@ -175,12 +226,49 @@ TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_IMAGE_MEMORY      == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.kernel.image.memory));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_ADDR_LOAD         == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.kernel.addr_load));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_ADDR_ENTRY        == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.kernel.addr_entry));
+TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_SEGMENT_COUNT     == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.kernel.segment_count));
+TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_KERNEL_SEGMENTS          == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.kernel.segments));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_CHECKSUM       == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.initramfs.checksum));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_ADDR_CART      == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.initramfs.addr_cart));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_INITRAMFS_LENGTH         == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.initramfs.length));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_COMMAND_LINE_CHECKSUM    == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.command_line.checksum));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_COMMAND_LINE_ADDR_CART   == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.command_line.addr_cart));
 TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_FILES_COMMAND_LINE_LENGTH      == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.files.command_line.length));
+TUX64_ASSERT_STATIC(TUX64_PLATFORM_MIPS_N64_BOOT_HEADER_OFFSET_DATA_PI_TIMING                      == TUX64_OFFSET_OF(struct Tux64PlatformMipsN64BootHeader, data.pi_timing));
+
+/*----------------------------------------------------------------------------*/
+/* Returns the number of zero bytes packed in ROM before a kernel segment.    */
+/* 'packed_end' is where the previous segment ends in the packed image, or 0  */
+/* for the first segment, and 'offset' is the segment's 'offset' field.       */
+/* Segments are padded so they start at the same address modulo               */
+/* TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENT_ALIGNMENT as they do in        */
+/* memory, which lets the bootloader move them into place with RSP DMA.       */
+/*----------------------------------------------------------------------------*/
+#define TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENT_ALIGNMENT\
+   (8u)
+
+Tux64UInt32
+tux64_platform_mips_n64_boot_kernel_segment_padding(
+   Tux64UInt32 packed_end,
+   Tux64UInt32 offset
+);
+
+/*----------------------------------------------------------------------------*/
+/* The PI domain 1 timing profiles which can be stored in the boot header,    */
+/* ordered from slowest to fastest.  When probing, the bootloader falls back  */
+/* through the profiles slower than the one stored in the boot header.        */
+/*----------------------------------------------------------------------------*/
+enum Tux64PlatformMipsN64BootPiTimingProfile {
+   TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_RETAIL,
+   TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_FAST,
+   TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_TURBO
+};
+
+#define TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILES_COUNT\
+   (3u)
+
+extern const struct Tux64PlatformMipsN64BootHeaderPiTiming
+tux64_platform_mips_n64_boot_pi_timing_profiles [TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILES_COUNT];
 
 /*----------------------------------------------------------------------------*/
 #endif /* !TUX64_PREPROCESSOR_ONLY */
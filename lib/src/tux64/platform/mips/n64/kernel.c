@@ -415,43 +415,59 @@ tux64_platform_mips_n64_kernel_program_headers_present(
    return TUX64_BOOLEAN_TRUE;
 }
 
-static struct Tux64PlatformMipsN64KernelParseResult
-tux64_platform_mips_n64_kernel_parse_main_segment(
+static Tux64Boolean
+tux64_platform_mips_n64_kernel_parse_segment(
+   struct Tux64PlatformMipsN64KernelSegment * segment,
+   Tux64UInt32 elf_bytes,
    Tux64UInt64 offset,
    Tux64UInt64 filesz,
    Tux64UInt64 memsz,
    Tux64UInt64 vaddr,
-   Tux64UInt64 entry
+   Tux64UInt64 align
 ) {
-   struct Tux64PlatformMipsN64KernelParseResult result;
-   struct Tux64PlatformMipsN64Kernel * kernel;
+   /* make sure the segment is contained in the file */
+   if (offset > (Tux64UInt64)elf_bytes)                  return TUX64_BOOLEAN_FALSE;
+   if (filesz > (Tux64UInt64)elf_bytes - offset)         return TUX64_BOOLEAN_FALSE;
+
+   /* verify the alignment is correct */
+   if (tux64_platform_mips_n64_kernel_segment_alignment_verify(offset, vaddr, align) == TUX64_BOOLEAN_FALSE) {
+      return TUX64_BOOLEAN_FALSE;
+   }
 
    /* since we're targetting a 32-bit address space, we now have to make sure */
-   /* the image can bit in 32 bits.  note that we ignore the N64 address      */
-   /* space.  this is because the console truncates those anyways, so we are  */
+   /* the segment can fit in 32 bits.  note that we ignore the N64 address    */
+   /* space.  this is because the console truncates those anyways, so we are */
    /* okay to allow this.                                                     */
-   if (filesz > TUX64_LITERAL_UINT64(TUX64_UINT32_MAX))  goto hell;
-   if (memsz > TUX64_LITERAL_UINT64(TUX64_UINT32_MAX))   goto hell;
+   if (memsz > TUX64_LITERAL_UINT64(TUX64_UINT32_MAX))   return TUX64_BOOLEAN_FALSE;
+   if (memsz < filesz)                                   return TUX64_BOOLEAN_FALSE;
 
-   /* just a few more sanity checks and we're done! */
-   if (memsz < filesz)           goto hell;
-   if (entry < vaddr)            goto hell;
-   if (entry - vaddr > filesz)   goto hell;
+   segment->offset      = (Tux64UInt32)offset;
+   segment->bytes       = (Tux64UInt32)filesz;
+   segment->memory      = (Tux64UInt32)memsz;
+   segment->addr_load   = (Tux64UInt32)vaddr;
+   return TUX64_BOOLEAN_TRUE;
+}
 
-   /* woot woot! */
-   kernel = &result.payload.ok;
-   kernel->image.offset = (Tux64UInt32)offset;
-   kernel->image.bytes  = (Tux64UInt32)filesz;
-   kernel->memory       = (Tux64UInt32)memsz;
-   kernel->addr_load    = (Tux64UInt32)vaddr;
-   kernel->addr_entry   = (Tux64UInt32)entry;
+static Tux64Boolean
+tux64_platform_mips_n64_kernel_parse_entry(
+   const struct Tux64PlatformMipsN64Kernel * kernel,
+   Tux64UInt32 entry
+) {
+   const struct Tux64PlatformMipsN64KernelSegment * segment;
+   Tux64UInt8 i;
 
-   result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_OK;
-   return result;
+   /* the entrypoint has to land inside data stored in the file, otherwise */
+   /* we would be jumping into zero-initialized memory. */
+   for (i = TUX64_LITERAL_UINT8(0u); i < kernel->segment_count; i++) {
+      segment = &kernel->segments[i];
 
-hell:
-   result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_CORRUPT_IMAGE;
-   return result;
+      if (entry < segment->addr_load)                    continue;
+      if (entry - segment->addr_load > segment->bytes)   continue;
+
+      return TUX64_BOOLEAN_TRUE;
+   }
+
+   return TUX64_BOOLEAN_FALSE;
 }
 
 static struct Tux64PlatformMipsN64KernelParseResult
@@ -464,7 +480,7 @@ tux64_platform_mips_n64_kernel_parse_program_headers(
    Tux64UInt16 phnum
 ) {
    struct Tux64PlatformMipsN64KernelParseResult result;
-   Tux64Boolean main_segment_found;
+   struct Tux64PlatformMipsN64Kernel * kernel;
    const Tux64UInt8 * iter_program_headers;
    union Tux64ElfProgramHeader program_header;
    Tux64UInt32 type;
@@ -473,9 +489,16 @@ tux64_platform_mips_n64_kernel_parse_program_headers(
    Tux64UInt64 memsz;
    Tux64UInt64 vaddr;
    Tux64UInt64 align;
+   Tux64UInt64 vaddr_first;
+   Tux64UInt64 vaddr_end;
+   Tux64UInt32 padding;
 
-   main_segment_found = TUX64_BOOLEAN_FALSE;
+   kernel = &result.payload.ok;
+   kernel->segment_count = TUX64_LITERAL_UINT8(0u);
+   kernel->image_bytes = TUX64_LITERAL_UINT32(0u);
    iter_program_headers = &elf_data[phoff];
+   vaddr_first = TUX64_LITERAL_UINT64(0u);
+   vaddr_end = TUX64_LITERAL_UINT64(0u);
 
    while (phnum != TUX64_LITERAL_UINT16(0u)) {
       tux64_memory_copy(
@@ -493,46 +516,83 @@ tux64_platform_mips_n64_kernel_parse_program_headers(
          continue;
       }
 
-      /* if we already found the main segment, bail out */
-      if (main_segment_found == TUX64_BOOLEAN_TRUE) {
-         result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_MAIN_SEGMENT_DUPLICATE;
+      /* bail out if we can't fit any more segments in the boot header */
+      if (kernel->segment_count == TUX64_LITERAL_UINT8(TUX64_PLATFORM_MIPS_N64_KERNEL_SEGMENTS_MAX)) {
+         result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_SEGMENT_OVERFLOW;
          return result;
       }
-      main_segment_found = TUX64_BOOLEAN_TRUE;
 
       offset   = tux64_platform_mips_n64_kernel_program_header_read_p_offset(&program_header, vtable);
       filesz   = tux64_platform_mips_n64_kernel_program_header_read_p_filesz(&program_header, vtable);
       memsz    = tux64_platform_mips_n64_kernel_program_header_read_p_memsz(&program_header, vtable);
       vaddr    = tux64_platform_mips_n64_kernel_program_header_read_p_vaddr(&program_header, vtable);
       align    = tux64_platform_mips_n64_kernel_program_header_read_p_align(&program_header, vtable);
-   }
 
-   /* now make sure we found the main segment */
-   if (main_segment_found == TUX64_BOOLEAN_FALSE) {
-      result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_MAIN_SEGMENT_MISSING;
-      return result;
+      /* the ELF spec requires loadable segments to be sorted by address, and */
+      /* the bootloader relies on this to place segments in-place, so we also */
+      /* forbid any overlap between segments. */
+      if (kernel->segment_count == TUX64_LITERAL_UINT8(0u)) {
+         vaddr_first = vaddr;
+      } else if (vaddr < vaddr_end) {
+         goto hell;
+      }
+      vaddr_end = vaddr + memsz;
+      if (vaddr_end < vaddr) goto hell;
+
+      if (tux64_platform_mips_n64_kernel_parse_segment(
+         &kernel->segments[kernel->segment_count],
+         elf_bytes,
+         offset,
+         filesz,
+         memsz,
+         vaddr,
+         align
+      ) == TUX64_BOOLEAN_FALSE) {
+         goto hell;
+      }
+
+      /* truncating the offset doesn't change its alignment, and the range */
+      /* of the whole image is checked once we have every segment. */
+      padding = tux64_platform_mips_n64_boot_kernel_segment_padding(
+         kernel->image_bytes,
+         (Tux64UInt32)(vaddr - vaddr_first)
+      );
+      kernel->segments[kernel->segment_count].padding = padding;
+
+      if (kernel->image_bytes > TUX64_UINT32_MAX - padding) goto hell;
+      kernel->image_bytes += padding;
+      if (kernel->image_bytes > TUX64_UINT32_MAX - (Tux64UInt32)filesz) goto hell;
+      kernel->image_bytes += (Tux64UInt32)filesz;
+
+      kernel->segment_count++;
    }
 
-   /* make sure the segment is contained in the file */
-   if (offset + filesz > (Tux64UInt64)elf_bytes) {
-      result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_CORRUPT_IMAGE;
+   /* now make sure we found at least one segment */
+   if (kernel->segment_count == TUX64_LITERAL_UINT8(0u)) {
+      result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_SEGMENT_MISSING;
       return result;
    }
 
-   /* verify the alignment is correct */
-   if (tux64_platform_mips_n64_kernel_segment_alignment_verify(offset, vaddr, align) == TUX64_BOOLEAN_FALSE) {
-      result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_CORRUPT_IMAGE;
-      return result;
+   /* make sure everything from the first to last segment can fit in our */
+   /* 32-bit address space. */
+   if (vaddr_end - vaddr_first > TUX64_LITERAL_UINT64(TUX64_UINT32_MAX)) goto hell;
+
+   kernel->memory       = (Tux64UInt32)(vaddr_end - vaddr_first);
+   kernel->addr_load    = (Tux64UInt32)vaddr_first;
+   kernel->addr_entry   = (Tux64UInt32)entry;
+
+   /* just one more sanity check and we're done! */
+   if (tux64_platform_mips_n64_kernel_parse_entry(kernel, kernel->addr_entry) == TUX64_BOOLEAN_FALSE) {
+      goto hell;
    }
 
-   /* and now proceed to the final verification */
-   return tux64_platform_mips_n64_kernel_parse_main_segment(
-      offset,
-      filesz,
-      memsz,
-      vaddr,
-      entry
-   );
+   /* woot woot! */
+   result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_OK;
+   return result;
+
+hell:
+   result.status = TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_CORRUPT_IMAGE;
+   return result;
 }
 
 static struct Tux64PlatformMipsN64KernelParseResult
@@ -11,35 +11,63 @@
 /*----------------------------------------------------------------------------*/
 
 #include "tux64/tux64.h"
+#include "tux64/platform/mips/n64/boot.h"
 
 /*----------------------------------------------------------------------------*/
-/* Describes the location of the kernel image data which needs to be loaded   */
-/* into memory.                                                               */
+/* The maximum number of loadable segments a kernel image may contain.        */
+/*----------------------------------------------------------------------------*/
+#define TUX64_PLATFORM_MIPS_N64_KERNEL_SEGMENTS_MAX\
+   TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX
+
+/*----------------------------------------------------------------------------*/
+/* Describes a single loadable segment of the kernel image.                   */
 /*----------------------------------------------------------------------------*/
 /* offset - The location within the file which contains the start of the      */
-/*    kernel image data.                                                      */
+/*    segment's data.                                                         */
+/*                                                                            */
+/* bytes - The length of the segment's data stored in the file, in bytes.     */
+/*                                                                            */
+/* memory - The length of the segment in memory, in bytes.  Any bytes past    */
+/*    'bytes' must be zero-initialized.  This will always be at least as long */
+/*    as 'bytes'.                                                             */
 /*                                                                            */
-/* bytes - The length of the kernel image data, in bytes.                     */
+/* addr_load - Where in memory the segment must be loaded.                    */
+/*                                                                            */
+/* padding - The number of zero bytes before the segment's data in the packed */
+/*    image, as returned by                                                   */
+/*    tux64_platform_mips_n64_boot_kernel_segment_padding().                  */
 /*----------------------------------------------------------------------------*/
-struct Tux64PlatformMipsN64KernelImage {
+struct Tux64PlatformMipsN64KernelSegment {
    Tux64UInt32 offset;
    Tux64UInt32 bytes;
+   Tux64UInt32 memory;
+   Tux64UInt32 addr_load;
+   Tux64UInt32 padding;
 };
 
 /*----------------------------------------------------------------------------*/
 /* Contains the data necessary to load and execute a kernel.                  */
 /*----------------------------------------------------------------------------*/
-/* image - The raw data which needs to be loaded into memory.                 */
+/* segments - The loadable segments, sorted by ascending load address.  No    */
+/*    two segments overlap in memory.                                         */
+/*                                                                            */
+/* segment_count - The number of valid entries in 'segments'.  This is never  */
+/*    zero.                                                                   */
+/*                                                                            */
+/* image_bytes - The sum of 'padding' and 'bytes' for every segment, which is */
+/*    the length of the packed image stored in ROM.                           */
 /*                                                                            */
-/* memory - The amount of memory required by the kernel to execute.  This     */
-/*    will always be at least as long as the kernel image.                    */
+/* memory - The amount of memory required by the kernel to execute, measured  */
+/*    from 'addr_load' to the end of the last segment in memory.              */
 /*                                                                            */
-/* addr_load - Where in memory the kernel image must be loaded.               */
+/* addr_load - Where in memory the first segment must be loaded.              */
 /*                                                                            */
 /* addr_entry - The address which contains the start of executable code.      */
 /*----------------------------------------------------------------------------*/
 struct Tux64PlatformMipsN64Kernel {
-   struct Tux64PlatformMipsN64KernelImage image;
+   struct Tux64PlatformMipsN64KernelSegment segments [TUX64_PLATFORM_MIPS_N64_KERNEL_SEGMENTS_MAX];
+   Tux64UInt8 segment_count;
+   Tux64UInt32 image_bytes;
    Tux64UInt32 memory;
    Tux64UInt32 addr_load;
    Tux64UInt32 addr_entry;
@@ -53,8 +81,8 @@ enum Tux64PlatformMipsN64KernelParseStatus {
    TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_INVALID_ENDIANESS,
    TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_INVALID_TYPE,
    TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_INVALID_MACHINE,
-   TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_MAIN_SEGMENT_MISSING,
-   TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_MAIN_SEGMENT_DUPLICATE
+   TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_SEGMENT_MISSING,
+   TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_SEGMENT_OVERFLOW
 };
 
 struct Tux64PlatformMipsN64KernelParsePayloadBadVersion {
@@ -82,8 +110,8 @@ struct Tux64PlatformMipsN64KernelParseResult {
 };
 
 /*----------------------------------------------------------------------------*/
-/* Parses a kernel ELF image into its singular PT_LOAD segment and relevant   */
-/* metadata.  Returned pointers have the same lifetime as the input pointers. */
+/* Parses a kernel ELF image into its PT_LOAD segments and relevant metadata. */
+/* Returned pointers have the same lifetime as the input pointers.            */
 /*----------------------------------------------------------------------------*/
 struct Tux64PlatformMipsN64KernelParseResult
 tux64_platform_mips_n64_kernel_parse(
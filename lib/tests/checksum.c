@@ -0,0 +1,173 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* lib/tests/checksum.c - Tests for checksum functions.                       */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64/tux64.h"
+#include "tux64/checksum.h"
+
+#include "tux64/memory.h"
+
+#include <stdio.h>
+
+#define TUX64_TEST_CHECKSUM_DATA_BYTES\
+   (4096u)
+#define TUX64_TEST_CHECKSUM_ITERATIONS\
+   (1000u)
+
+/* the longest piece of data digested at once, and the most words in a part */
+#define TUX64_TEST_CHECKSUM_PIECE_BYTES_MAX\
+   (9u)
+#define TUX64_TEST_CHECKSUM_PART_WORDS_MAX\
+   (24u)
+
+static Tux64UInt8
+tux64_test_checksum_data [TUX64_TEST_CHECKSUM_DATA_BYTES];
+
+/* xorshift32, so every run tests the same splits */
+static Tux64UInt32
+tux64_test_checksum_random(
+   Tux64UInt32 * state
+) {
+   *state ^= *state << 13u;
+   *state ^= *state >> 17u;
+   *state ^= *state << 5u;
+
+   return *state;
+}
+
+/* digests 'bytes' bytes of 'data' in randomly sized pieces, including empty */
+/* pieces and pieces which don't complete a word. */
+static void
+tux64_test_checksum_digest_pieces(
+   struct Tux64ChecksumContext * context,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes,
+   Tux64UInt32 * state
+) {
+   Tux64UInt32 piece_bytes;
+
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      piece_bytes = tux64_test_checksum_random(state) % TUX64_LITERAL_UINT32(TUX64_TEST_CHECKSUM_PIECE_BYTES_MAX + 1u);
+      if (piece_bytes > bytes) {
+         piece_bytes = bytes;
+      }
+
+      tux64_checksum_fletcher_64_32.digest(context, data, piece_bytes);
+
+      data += piece_bytes;
+      bytes -= piece_bytes;
+   }
+
+   return;
+}
+
+/* splits the data into parts which are digested separately, then merged in */
+/* order.  every part but the last must be a multiple of the merge */
+/* alignment, so parts are a random number of words, including none, and */
+/* the last part is whatever's left, which may be shorter than a word. */
+static void
+tux64_test_checksum_digest_parts(
+   struct Tux64ChecksumContext * context,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes,
+   Tux64UInt32 * state
+) {
+   struct Tux64ChecksumContext part;
+   Tux64UInt32 part_bytes;
+
+   tux64_checksum_fletcher_64_32.initialize(context);
+
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      part_bytes = tux64_test_checksum_random(state) % TUX64_LITERAL_UINT32(TUX64_TEST_CHECKSUM_PART_WORDS_MAX + 1u);
+      part_bytes *= TUX64_LITERAL_UINT32(TUX64_CHECKSUM_FLETCHER_64_32_MERGE_ALIGNMENT);
+      if (part_bytes > bytes) {
+         part_bytes = bytes;
+      }
+
+      tux64_checksum_fletcher_64_32.initialize(&part);
+      tux64_test_checksum_digest_pieces(&part, data, part_bytes, state);
+      tux64_checksum_fletcher_64_32.merge(context, &part, part_bytes);
+
+      data += part_bytes;
+      bytes -= part_bytes;
+   }
+
+   return;
+}
+
+static Tux64Boolean
+tux64_test_checksum_matches(
+   struct Tux64ChecksumContext * context,
+   const Tux64UInt8 * expected,
+   const char * name,
+   Tux64UInt32 bytes,
+   Tux64UInt32 iteration
+) {
+   const Tux64UInt8 * digest;
+
+   digest = tux64_checksum_fletcher_64_32.finalize(context);
+   if (tux64_memory_compare_with_equal_lengths(
+      digest,
+      expected,
+      TUX64_LITERAL_UINT32(TUX64_CHECKSUM_FLETCHER_64_32_DIGEST_BYTES)
+   ) == TUX64_BOOLEAN_TRUE) {
+      return TUX64_BOOLEAN_TRUE;
+   }
+
+   (void)fprintf(stderr, "error: %s digest of %u bytes doesn't match on iteration %u\n", name, (unsigned int)bytes, (unsigned int)iteration);
+   return TUX64_BOOLEAN_FALSE;
+}
+
+int main(void) {
+   struct Tux64ChecksumContext context;
+   Tux64UInt8 expected [TUX64_CHECKSUM_FLETCHER_64_32_DIGEST_BYTES];
+   Tux64UInt32 state;
+   Tux64UInt32 bytes;
+   Tux64UInt32 i;
+   int status;
+
+   state = TUX64_LITERAL_UINT32(0x7475786Cu);
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_TEST_CHECKSUM_DATA_BYTES)) {
+      tux64_test_checksum_data[i] = (Tux64UInt8)tux64_test_checksum_random(&state);
+      i++;
+   }
+
+   status = 0;
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_TEST_CHECKSUM_ITERATIONS)) {
+      /* test every length shorter than a few words, then random lengths */
+      bytes = i;
+      if (bytes > TUX64_LITERAL_UINT32(16u)) {
+         bytes = tux64_test_checksum_random(&state) % TUX64_LITERAL_UINT32(TUX64_TEST_CHECKSUM_DATA_BYTES + 1u);
+      }
+
+      tux64_checksum_fletcher_64_32.initialize(&context);
+      tux64_checksum_fletcher_64_32.digest(&context, tux64_test_checksum_data, bytes);
+      tux64_memory_copy(
+         expected,
+         tux64_checksum_fletcher_64_32.finalize(&context),
+         TUX64_LITERAL_UINT32(sizeof(expected))
+      );
+
+      tux64_checksum_fletcher_64_32.initialize(&context);
+      tux64_test_checksum_digest_pieces(&context, tux64_test_checksum_data, bytes, &state);
+      if (tux64_test_checksum_matches(&context, expected, "sequential", bytes, i) == TUX64_BOOLEAN_FALSE) {
+         status = 1;
+      }
+
+      tux64_test_checksum_digest_parts(&context, tux64_test_checksum_data, bytes, &state);
+      if (tux64_test_checksum_matches(&context, expected, "merged", bytes, i) == TUX64_BOOLEAN_FALSE) {
+         status = 1;
+      }
+
+      i++;
+   }
+
+   return status;
+}
+
@@ -0,0 +1,338 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* lib/tests/memory.c - Tests for memory functions.                           */
+/*----------------------------------------------------------------------------*/
+
+#include "tux64/tux64.h"
+#include "tux64/memory.h"
+
+#include <stdio.h>
+
+/* this is built with TUX64_HAVE_STRING_H disabled, so these test our own */
+/* fallbacks rather than libc. */
+
+/* the buffers are made of words so we know where the word boundaries are */
+#define TUX64_TEST_MEMORY_BUFFER_WORDS\
+   (32u)
+#define TUX64_TEST_MEMORY_BUFFER_BYTES\
+   (TUX64_TEST_MEMORY_BUFFER_WORDS * sizeof(Tux64UInt64))
+
+/* every misalignment of the head, and lengths long enough to cover the */
+/* unrolled loops followed by every possible tail */
+#define TUX64_TEST_MEMORY_OFFSET_MAX\
+   (sizeof(Tux64UInt64))
+#define TUX64_TEST_MEMORY_MOVE_OFFSET_MAX\
+   (3u * sizeof(Tux64UInt64))
+#define TUX64_TEST_MEMORY_BYTES_MAX\
+   (80u)
+
+/* the largest element passed to tux64_memory_fill() */
+#define TUX64_TEST_MEMORY_ELEMENT_BYTES_MAX\
+   (12u)
+
+static Tux64UInt64
+tux64_test_memory_buffer_words [TUX64_TEST_MEMORY_BUFFER_WORDS];
+static Tux64UInt64
+tux64_test_memory_source_words [TUX64_TEST_MEMORY_BUFFER_WORDS];
+static Tux64UInt8
+tux64_test_memory_expected [TUX64_TEST_MEMORY_BUFFER_BYTES];
+
+#define tux64_test_memory_buffer\
+   ((Tux64UInt8 *)tux64_test_memory_buffer_words)
+#define tux64_test_memory_source\
+   ((Tux64UInt8 *)tux64_test_memory_source_words)
+
+/* xorshift32, so every run tests the same data */
+static Tux64UInt32
+tux64_test_memory_random(
+   Tux64UInt32 * state
+) {
+   *state ^= *state << 13u;
+   *state ^= *state >> 17u;
+   *state ^= *state << 5u;
+
+   return *state;
+}
+
+/* fills the buffer, the source and the expected result with random data, */
+/* where the expected result starts out the same as the buffer. */
+static void
+tux64_test_memory_randomize(
+   Tux64UInt32 * state
+) {
+   Tux64UInt32 i;
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_BUFFER_BYTES)) {
+      tux64_test_memory_buffer[i] = (Tux64UInt8)tux64_test_memory_random(state);
+      tux64_test_memory_source[i] = (Tux64UInt8)tux64_test_memory_random(state);
+      tux64_test_memory_expected[i] = tux64_test_memory_buffer[i];
+      i++;
+   }
+
+   return;
+}
+
+/* checks the whole buffer, so writes outside of the range are caught too */
+static Tux64Boolean
+tux64_test_memory_matches(
+   const char * name,
+   Tux64UInt32 offset,
+   Tux64UInt32 bytes
+) {
+   Tux64UInt32 i;
+
+   i = TUX64_LITERAL_UINT32(0u);
+   while (i != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_BUFFER_BYTES)) {
+      if (tux64_test_memory_buffer[i] != tux64_test_memory_expected[i]) {
+         (void)fprintf(stderr, "error: %s of %u bytes at offset %u is wrong at byte %u\n", name, (unsigned int)bytes, (unsigned int)offset, (unsigned int)i);
+         return TUX64_BOOLEAN_FALSE;
+      }
+
+      i++;
+   }
+
+   return TUX64_BOOLEAN_TRUE;
+}
+
+static Tux64Boolean
+tux64_test_memory_copy(
+   Tux64UInt32 * state
+) {
+   Tux64UInt32 offset_dest;
+   Tux64UInt32 offset_src;
+   Tux64UInt32 bytes;
+   Tux64UInt32 i;
+   Tux64Boolean retn;
+
+   retn = TUX64_BOOLEAN_TRUE;
+   offset_dest = TUX64_LITERAL_UINT32(0u);
+   while (offset_dest != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_OFFSET_MAX)) {
+      offset_src = TUX64_LITERAL_UINT32(0u);
+      while (offset_src != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_OFFSET_MAX)) {
+         bytes = TUX64_LITERAL_UINT32(0u);
+         while (bytes != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_BYTES_MAX + 1u)) {
+            tux64_test_memory_randomize(state);
+
+            i = TUX64_LITERAL_UINT32(0u);
+            while (i != bytes) {
+               tux64_test_memory_expected[offset_dest + i] = tux64_test_memory_source[offset_src + i];
+               i++;
+            }
+
+            tux64_memory_copy(
+               &tux64_test_memory_buffer[offset_dest],
+               &tux64_test_memory_source[offset_src],
+               bytes
+            );
+            if (tux64_test_memory_matches("copy", offset_dest, bytes) == TUX64_BOOLEAN_FALSE) {
+               retn = TUX64_BOOLEAN_FALSE;
+            }
+
+            bytes++;
+         }
+
+         offset_src++;
+      }
+
+      offset_dest++;
+   }
+
+   return retn;
+}
+
+/* moves within the same buffer, so the regions overlap whenever the */
+/* offsets are closer than the length, in both directions. */
+static Tux64Boolean
+tux64_test_memory_move(
+   Tux64UInt32 * state
+) {
+   Tux64UInt8 moved [TUX64_TEST_MEMORY_BYTES_MAX];
+   Tux64UInt32 offset_dest;
+   Tux64UInt32 offset_src;
+   Tux64UInt32 bytes;
+   Tux64UInt32 i;
+   Tux64Boolean retn;
+
+   retn = TUX64_BOOLEAN_TRUE;
+   offset_dest = TUX64_LITERAL_UINT32(0u);
+   while (offset_dest != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_MOVE_OFFSET_MAX)) {
+      offset_src = TUX64_LITERAL_UINT32(0u);
+      while (offset_src != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_MOVE_OFFSET_MAX)) {
+         bytes = TUX64_LITERAL_UINT32(0u);
+         while (bytes != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_BYTES_MAX + 1u)) {
+            tux64_test_memory_randomize(state);
+
+            /* the reference goes through a separate buffer, so it can't */
+            /* be affected by the overlap. */
+            i = TUX64_LITERAL_UINT32(0u);
+            while (i != bytes) {
+               moved[i] = tux64_test_memory_expected[offset_src + i];
+               i++;
+            }
+            i = TUX64_LITERAL_UINT32(0u);
+            while (i != bytes) {
+               tux64_test_memory_expected[offset_dest + i] = moved[i];
+               i++;
+            }
+
+            tux64_memory_move(
+               &tux64_test_memory_buffer[offset_dest],
+               &tux64_test_memory_buffer[offset_src],
+               bytes
+            );
+            if (tux64_test_memory_matches("move", offset_dest, bytes) == TUX64_BOOLEAN_FALSE) {
+               retn = TUX64_BOOLEAN_FALSE;
+            }
+
+            bytes++;
+         }
+
+         offset_src++;
+      }
+
+      offset_dest++;
+   }
+
+   return retn;
+}
+
+static Tux64Boolean
+tux64_test_memory_fill(
+   Tux64UInt32 * state
+) {
+   Tux64UInt32 offset_dest;
+   Tux64UInt32 bytes_per_element;
+   Tux64UInt32 elements;
+   Tux64UInt32 bytes;
+   Tux64UInt32 i;
+   Tux64Boolean retn;
+
+   retn = TUX64_BOOLEAN_TRUE;
+   offset_dest = TUX64_LITERAL_UINT32(0u);
+   while (offset_dest != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_OFFSET_MAX)) {
+      bytes_per_element = TUX64_LITERAL_UINT32(1u);
+      while (bytes_per_element != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_ELEMENT_BYTES_MAX + 1u)) {
+         elements = TUX64_LITERAL_UINT32(0u);
+         while (elements * bytes_per_element <= TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_BYTES_MAX)) {
+            tux64_test_memory_randomize(state);
+
+            /* the sentinel is taken from the start of the source */
+            bytes = elements * bytes_per_element;
+            i = TUX64_LITERAL_UINT32(0u);
+            while (i != bytes) {
+               tux64_test_memory_expected[offset_dest + i] = tux64_test_memory_source[i % bytes_per_element];
+               i++;
+            }
+
+            tux64_memory_fill(
+               &tux64_test_memory_buffer[offset_dest],
+               tux64_test_memory_source,
+               elements,
+               bytes_per_element
+            );
+            if (tux64_test_memory_matches("fill", offset_dest, bytes) == TUX64_BOOLEAN_FALSE) {
+               retn = TUX64_BOOLEAN_FALSE;
+            }
+
+            elements++;
+         }
+
+         bytes_per_element++;
+      }
+
+      offset_dest++;
+   }
+
+   return retn;
+}
+
+/* compares equal data, then the same data with each byte changed in turn */
+static Tux64Boolean
+tux64_test_memory_compare(
+   Tux64UInt32 * state
+) {
+   Tux64UInt32 offset_lhs;
+   Tux64UInt32 offset_rhs;
+   Tux64UInt32 bytes;
+   Tux64UInt32 i;
+   Tux64Boolean retn;
+
+   retn = TUX64_BOOLEAN_TRUE;
+   offset_lhs = TUX64_LITERAL_UINT32(0u);
+   while (offset_lhs != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_OFFSET_MAX)) {
+      offset_rhs = TUX64_LITERAL_UINT32(0u);
+      while (offset_rhs != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_OFFSET_MAX)) {
+         bytes = TUX64_LITERAL_UINT32(0u);
+         while (bytes != TUX64_LITERAL_UINT32(TUX64_TEST_MEMORY_BYTES_MAX + 1u)) {
+            tux64_test_memory_randomize(state);
+
+            i = TUX64_LITERAL_UINT32(0u);
+            while (i != bytes) {
+               tux64_test_memory_source[offset_rhs + i] = tux64_test_memory_buffer[offset_lhs + i];
+               i++;
+            }
+
+            if (tux64_memory_compare_with_equal_lengths(
+               &tux64_test_memory_buffer[offset_lhs],
+               &tux64_test_memory_source[offset_rhs],
+               bytes
+            ) == TUX64_BOOLEAN_FALSE) {
+               (void)fprintf(stderr, "error: compare of %u equal bytes at offsets %u and %u failed\n", (unsigned int)bytes, (unsigned int)offset_lhs, (unsigned int)offset_rhs);
+               retn = TUX64_BOOLEAN_FALSE;
+            }
+
+            i = TUX64_LITERAL_UINT32(0u);
+            while (i != bytes) {
+               tux64_test_memory_source[offset_rhs + i] ^= TUX64_LITERAL_UINT8(0x80u);
+
+               if (tux64_memory_compare_with_equal_lengths(
+                  &tux64_test_memory_buffer[offset_lhs],
+                  &tux64_test_memory_source[offset_rhs],
+                  bytes
+               ) == TUX64_BOOLEAN_TRUE) {
+                  (void)fprintf(stderr, "error: compare of %u bytes at offsets %u and %u missed a difference at byte %u\n", (unsigned int)bytes, (unsigned int)offset_lhs, (unsigned int)offset_rhs, (unsigned int)i);
+                  retn = TUX64_BOOLEAN_FALSE;
+               }
+
+               tux64_test_memory_source[offset_rhs + i] ^= TUX64_LITERAL_UINT8(0x80u);
+               i++;
+            }
+
+            bytes++;
+         }
+
+         offset_rhs++;
+      }
+
+      offset_lhs++;
+   }
+
+   return retn;
+}
+
+int main(void) {
+   Tux64UInt32 state;
+   int status;
+
+   state = TUX64_LITERAL_UINT32(0x7475786Cu);
+   status = 0;
+
+   if (tux64_test_memory_copy(&state) == TUX64_BOOLEAN_FALSE) {
+      status = 1;
+   }
+   if (tux64_test_memory_move(&state) == TUX64_BOOLEAN_FALSE) {
+      status = 1;
+   }
+   if (tux64_test_memory_fill(&state) == TUX64_BOOLEAN_FALSE) {
+      status = 1;
+   }
+   if (tux64_test_memory_compare(&state) == TUX64_BOOLEAN_FALSE) {
+      status = 1;
+   }
+
+   return status;
+}
+
@@ -157,6 +157,59 @@ tux64_mkrom_arguments_command_line_parser_prefix(
    );
 }
 
+static struct Tux64ArgumentsParseOptionResult
+tux64_mkrom_arguments_command_line_parser_cache(
+   const struct Tux64String * parameter,
+   void * context
+) {
+   struct Tux64MkromArgumentsCommandLine * arguments;
+
+   arguments = (struct Tux64MkromArgumentsCommandLine *)context;
+
+   return tux64_mkrom_arguments_parser_string(
+      parameter,
+      &arguments->path_cache
+   );
+}
+
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PARSER_JOBS_ZERO\
+   "must be at least 1"
+
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PARSER_JOBS_ZERO_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PARSER_JOBS_ZERO)
+
+static struct Tux64ArgumentsParseOptionResult
+tux64_mkrom_arguments_command_line_parser_jobs(
+   const struct Tux64String * parameter,
+   void * context
+) {
+   struct Tux64MkromArgumentsCommandLine * arguments;
+   struct Tux64ArgumentsParseOptionResult result;
+   struct Tux64ParseStringIntegerResult parse_result;
+
+   arguments = (struct Tux64MkromArgumentsCommandLine *)context;
+
+   if (parameter->characters == TUX64_LITERAL_UINT32(0u)) {
+      result.status = TUX64_ARGUMENTS_PARSE_STATUS_PARAMETER_MISSING;
+      return result;
+   }
+
+   parse_result = tux64_parse_string_integer_decimal_uint8(parameter, &arguments->jobs);
+   result = tux64_mkrom_arguments_parser_string_integer_hex_format_result(&parse_result);
+   if (result.status != TUX64_ARGUMENTS_PARSE_STATUS_OK) {
+      return result;
+   }
+
+   if (arguments->jobs == TUX64_LITERAL_UINT8(0u)) {
+      result.status = TUX64_ARGUMENTS_PARSE_STATUS_PARAMETER_INVALID;
+      result.payload.parameter_invalid.reason.ptr = TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PARSER_JOBS_ZERO;
+      result.payload.parameter_invalid.reason.characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PARSER_JOBS_ZERO_CHARACTERS);
+      return result;
+   }
+
+   return result;
+}
+
 static struct Tux64ArgumentsParseOptionResult
 tux64_mkrom_arguments_command_line_parser_help(
    const struct Tux64String * parameter,
@@ -207,6 +260,14 @@ tux64_mkrom_arguments_command_line_parser_version(
    "prefix"
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_IDENTIFIER_SHORT\
    'p'
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIER_LONG\
+   "cache"
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIER_SHORT\
+   'u'
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIER_LONG\
+   "jobs"
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIER_SHORT\
+   'j'
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_HELP_IDENTIFIER_LONG\
    "help"
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_HELP_IDENTIFIER_SHORT_A\
@@ -224,6 +285,10 @@ tux64_mkrom_arguments_command_line_parser_version(
    TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_OUTPUT_IDENTIFIER_LONG)
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_IDENTIFIER_LONG_CHARACTERS\
    TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_IDENTIFIER_LONG)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIER_LONG_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIER_LONG)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIER_LONG_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIER_LONG)
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_HELP_IDENTIFIER_LONG_CHARACTERS\
    TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_HELP_IDENTIFIER_LONG)
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_VERSION_IDENTIFIER_LONG_CHARACTERS\
@@ -263,6 +328,28 @@ tux64_mkrom_arguments_command_line_option_prefix_identifiers_short [] = {
    TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_IDENTIFIER_SHORT
 };
 static const struct Tux64String
+tux64_mkrom_arguments_command_line_option_cache_identifiers_long [] = {
+   {
+      .ptr        = TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIER_LONG,
+      .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIER_LONG_CHARACTERS)
+   }
+};
+static const char
+tux64_mkrom_arguments_command_line_option_cache_identifiers_short [] = {
+   TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIER_SHORT
+};
+static const struct Tux64String
+tux64_mkrom_arguments_command_line_option_jobs_identifiers_long [] = {
+   {
+      .ptr        = TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIER_LONG,
+      .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIER_LONG_CHARACTERS)
+   }
+};
+static const char
+tux64_mkrom_arguments_command_line_option_jobs_identifiers_short [] = {
+   TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIER_SHORT
+};
+static const struct Tux64String
 tux64_mkrom_arguments_command_line_option_help_identifiers_long [] = {
    {
       .ptr        = TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_HELP_IDENTIFIER_LONG,
@@ -298,6 +385,14 @@ tux64_mkrom_arguments_command_line_option_version_identifiers_short [] = {
    TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_command_line_option_prefix_identifiers_long)
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_IDENTIFIERS_SHORT_COUNT\
    TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_command_line_option_prefix_identifiers_short)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIERS_LONG_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_command_line_option_cache_identifiers_long)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIERS_SHORT_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_command_line_option_cache_identifiers_short)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIERS_LONG_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_command_line_option_jobs_identifiers_long)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIERS_SHORT_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_command_line_option_jobs_identifiers_short)
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_HELP_IDENTIFIERS_LONG_COUNT\
    TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_command_line_option_help_identifiers_long)
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_HELP_IDENTIFIERS_SHORT_COUNT\
@@ -311,6 +406,14 @@ tux64_mkrom_arguments_command_line_option_version_identifiers_short [] = {
    ""
 #define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_DEFAULT_VALUE_CHARACTERS\
    TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_DEFAULT_VALUE)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_DEFAULT_VALUE\
+   ""
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_DEFAULT_VALUE_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_DEFAULT_VALUE)
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_DEFAULT_VALUE\
+   1u
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_DEFAULT_VALUE_STRING\
+   "1"
 
 static const struct Tux64ArgumentsOption
 tux64_mkrom_arguments_command_line_options_required [] = {
@@ -339,6 +442,20 @@ tux64_mkrom_arguments_command_line_options_optional [] = {
       .identifiers_short_count   = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_IDENTIFIERS_SHORT_COUNT),
       .parser                    = tux64_mkrom_arguments_command_line_parser_prefix
    },
+   {
+      .identifiers_long          = tux64_mkrom_arguments_command_line_option_cache_identifiers_long,
+      .identifiers_short         = tux64_mkrom_arguments_command_line_option_cache_identifiers_short,
+      .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIERS_LONG_COUNT),
+      .identifiers_short_count   = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_IDENTIFIERS_SHORT_COUNT),
+      .parser                    = tux64_mkrom_arguments_command_line_parser_cache
+   },
+   {
+      .identifiers_long          = tux64_mkrom_arguments_command_line_option_jobs_identifiers_long,
+      .identifiers_short         = tux64_mkrom_arguments_command_line_option_jobs_identifiers_short,
+      .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIERS_LONG_COUNT),
+      .identifiers_short_count   = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_IDENTIFIERS_SHORT_COUNT),
+      .parser                    = tux64_mkrom_arguments_command_line_parser_jobs
+   },
    {
       .identifiers_long          = tux64_mkrom_arguments_command_line_option_help_identifiers_long,
       .identifiers_short         = tux64_mkrom_arguments_command_line_option_help_identifiers_short,
@@ -398,6 +515,9 @@ tux64_mkrom_arguments_command_line_initialize_optional(
 ) {
    output->path_prefix.ptr          = TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_DEFAULT_VALUE;
    output->path_prefix.characters   = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_PREFIX_DEFAULT_VALUE_CHARACTERS);
+   output->path_cache.ptr           = TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_DEFAULT_VALUE;
+   output->path_cache.characters    = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_DEFAULT_VALUE_CHARACTERS);
+   output->jobs                     = TUX64_LITERAL_UINT8(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_DEFAULT_VALUE);
    return;
 }
 
@@ -610,6 +730,210 @@ tux64_mkrom_arguments_config_file_parser_memory_display(
    return result;
 }
 
+static struct Tux64ArgumentsParseOptionResult
+tux64_mkrom_arguments_config_file_parser_pi_timing_probe(
+   const struct Tux64String * parameter,
+   void * context
+) {
+   struct Tux64ArgumentsParseOptionResult result;
+   struct Tux64MkromArgumentsConfigFile * arguments;
+
+   arguments = (struct Tux64MkromArgumentsConfigFile *)context;
+
+   if (parameter->characters != TUX64_LITERAL_UINT32(0u)) {
+      result.status = TUX64_ARGUMENTS_PARSE_STATUS_PARAMETER_UNEXPECTED;
+      return result;
+   }
+
+   arguments->boot_header_flags = tux64_bitwise_flags_set_uint32(
+      arguments->boot_header_flags,
+      TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING_PROBE)
+   );
+
+   result.status = TUX64_ARGUMENTS_PARSE_STATUS_OK;
+   return result;
+}
+
+static struct Tux64ArgumentsParseOptionResult
+tux64_mkrom_arguments_config_file_parser_stats_display(
+   const struct Tux64String * parameter,
+   void * context
+) {
+   struct Tux64ArgumentsParseOptionResult result;
+   struct Tux64MkromArgumentsConfigFile * arguments;
+
+   arguments = (struct Tux64MkromArgumentsConfigFile *)context;
+
+   if (parameter->characters != TUX64_LITERAL_UINT32(0u)) {
+      result.status = TUX64_ARGUMENTS_PARSE_STATUS_PARAMETER_UNEXPECTED;
+      return result;
+   }
+
+   arguments->boot_header_flags = tux64_bitwise_flags_set_uint32(
+      arguments->boot_header_flags,
+      TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_STATS_DISPLAY)
+   );
+
+   result.status = TUX64_ARGUMENTS_PARSE_STATUS_OK;
+   return result;
+}
+
+static struct Tux64ArgumentsParseOptionResult
+tux64_mkrom_arguments_config_file_parser_headless(
+   const struct Tux64String * parameter,
+   void * context
+) {
+   struct Tux64ArgumentsParseOptionResult result;
+   struct Tux64MkromArgumentsConfigFile * arguments;
+
+   arguments = (struct Tux64MkromArgumentsConfigFile *)context;
+
+   if (parameter->characters != TUX64_LITERAL_UINT32(0u)) {
+      result.status = TUX64_ARGUMENTS_PARSE_STATUS_PARAMETER_UNEXPECTED;
+      return result;
+   }
+
+   arguments->boot_header_flags = tux64_bitwise_flags_set_uint32(
+      arguments->boot_header_flags,
+      TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_HEADLESS)
+   );
+
+   result.status = TUX64_ARGUMENTS_PARSE_STATUS_OK;
+   return result;
+}
+
+struct Tux64MkromArgumentsPiTimingProfile {
+   struct Tux64String name;
+   Tux64Boolean enable;
+   const struct Tux64PlatformMipsN64BootHeaderPiTiming * timing;
+};
+
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL\
+   "ipl"
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_RETAIL\
+   "retail"
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_FAST\
+   "fast"
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_TURBO\
+   "turbo"
+
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL)
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_RETAIL_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_RETAIL)
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_FAST_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_FAST)
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_TURBO_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_TURBO)
+
+/* "ipl" leaves whatever the IPL configured from the ROM header untouched, */
+/* so its timings are never used. */
+static const struct Tux64PlatformMipsN64BootHeaderPiTiming
+tux64_mkrom_arguments_pi_timing_ipl = {
+   .lat = TUX64_LITERAL_UINT8(0x00u),
+   .pwd = TUX64_LITERAL_UINT8(0x00u),
+   .pgs = TUX64_LITERAL_UINT8(0x00u),
+   .rls = TUX64_LITERAL_UINT8(0x00u)
+};
+
+/* "fast" and "turbo" are only tolerated by flashcarts and other cartridges */
+/* with fast flash chips, so pair these with the probe. */
+static const struct Tux64MkromArgumentsPiTimingProfile
+tux64_mkrom_arguments_pi_timing_profiles [] = {
+   {
+      .name = {
+         .ptr        = TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL,
+         .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL_CHARACTERS)
+      },
+      .enable = TUX64_BOOLEAN_FALSE,
+      .timing = &tux64_mkrom_arguments_pi_timing_ipl
+   },
+   {
+      .name = {
+         .ptr        = TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_RETAIL,
+         .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_RETAIL_CHARACTERS)
+      },
+      .enable = TUX64_BOOLEAN_TRUE,
+      .timing = &tux64_platform_mips_n64_boot_pi_timing_profiles[TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_RETAIL]
+   },
+   {
+      .name = {
+         .ptr        = TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_FAST,
+         .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_FAST_CHARACTERS)
+      },
+      .enable = TUX64_BOOLEAN_TRUE,
+      .timing = &tux64_platform_mips_n64_boot_pi_timing_profiles[TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_FAST]
+   },
+   {
+      .name = {
+         .ptr        = TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_TURBO,
+         .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_TURBO_CHARACTERS)
+      },
+      .enable = TUX64_BOOLEAN_TRUE,
+      .timing = &tux64_platform_mips_n64_boot_pi_timing_profiles[TUX64_PLATFORM_MIPS_N64_BOOT_PI_TIMING_PROFILE_TURBO]
+   }
+};
+
+#define TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILES_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_pi_timing_profiles)
+
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_PARSER_PI_TIMING_ERROR_UNKNOWN_PROFILE\
+   "unknown profile, expected one of \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL "\", \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_RETAIL "\", \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_FAST "\", or \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_TURBO "\""
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_PARSER_PI_TIMING_ERROR_UNKNOWN_PROFILE_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_PARSER_PI_TIMING_ERROR_UNKNOWN_PROFILE)
+
+static struct Tux64ArgumentsParseOptionResult
+tux64_mkrom_arguments_config_file_parser_pi_timing(
+   const struct Tux64String * parameter,
+   void * context
+) {
+   struct Tux64ArgumentsParseOptionResult result;
+   struct Tux64MkromArgumentsConfigFile * arguments;
+   const struct Tux64MkromArgumentsPiTimingProfile * profile;
+   Tux64UInt32 i;
+
+   arguments = (struct Tux64MkromArgumentsConfigFile *)context;
+
+   if (parameter->characters == TUX64_LITERAL_UINT32(0u)) {
+      result.status = TUX64_ARGUMENTS_PARSE_STATUS_PARAMETER_MISSING;
+      return result;
+   }
+
+   for (i = TUX64_LITERAL_UINT32(0u); i < TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILES_COUNT); i++) {
+      profile = &tux64_mkrom_arguments_pi_timing_profiles[i];
+
+      if (tux64_memory_compare(
+         parameter->ptr,
+         profile->name.ptr,
+         parameter->characters * TUX64_LITERAL_UINT32(sizeof(char)),
+         profile->name.characters * TUX64_LITERAL_UINT32(sizeof(char))
+      ) == TUX64_BOOLEAN_FALSE) {
+         continue;
+      }
+
+      if (profile->enable == TUX64_BOOLEAN_TRUE) {
+         arguments->boot_header_flags = tux64_bitwise_flags_set_uint32(
+            arguments->boot_header_flags,
+            TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING)
+         );
+      } else {
+         arguments->boot_header_flags = tux64_bitwise_flags_clear_uint32(
+            arguments->boot_header_flags,
+            TUX64_LITERAL_UINT32(TUX64_PLATFORM_MIPS_N64_BOOT_FLAG_PI_TIMING)
+         );
+      }
+      arguments->pi_timing = *profile->timing;
+
+      result.status = TUX64_ARGUMENTS_PARSE_STATUS_OK;
+      return result;
+   }
+
+   result.status = TUX64_ARGUMENTS_PARSE_STATUS_PARAMETER_INVALID;
+   result.payload.parameter_invalid.reason.ptr = TUX64_MKROM_ARGUMENTS_CONFIG_FILE_PARSER_PI_TIMING_ERROR_UNKNOWN_PROFILE;
+   result.payload.parameter_invalid.reason.characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_PARSER_PI_TIMING_ERROR_UNKNOWN_PROFILE_CHARACTERS);
+   return result;
+}
+
 static struct Tux64ArgumentsParseOptionResult
 tux64_mkrom_arguments_config_file_parser_rom_header_clock_rate(
    const struct Tux64String * parameter,
@@ -787,6 +1111,14 @@ tux64_mkrom_arguments_config_file_parser_rom_header_game_code(
    "no-delay"
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_MEMORY_DISPLAY_IDENTIFIER\
    "memory-display"
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_IDENTIFIER\
+   "pi-timing"
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_PROBE_IDENTIFIER\
+   "pi-timing-probe"
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_STATS_DISPLAY_IDENTIFIER\
+   "stats-display"
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_HEADLESS_IDENTIFIER\
+   "headless"
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_CLOCK_RATE_IDENTIFIER\
    "rom-header-clock-rate"
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_BOOT_ADDRESS_IDENTIFIER\
@@ -820,6 +1152,14 @@ tux64_mkrom_arguments_config_file_parser_rom_header_game_code(
    TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_NO_DELAY_IDENTIFIER)
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_MEMORY_DISPLAY_IDENTIFIER_CHARACTERS\
    TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_MEMORY_DISPLAY_IDENTIFIER)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_IDENTIFIER_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_IDENTIFIER)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_PROBE_IDENTIFIER_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_PROBE_IDENTIFIER)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_STATS_DISPLAY_IDENTIFIER_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_STATS_DISPLAY_IDENTIFIER)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_HEADLESS_IDENTIFIER_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_HEADLESS_IDENTIFIER)
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_CLOCK_RATE_IDENTIFIER_CHARACTERS\
    TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_CLOCK_RATE_IDENTIFIER)
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_BOOT_ADDRESS_IDENTIFIER_CHARACTERS\
@@ -919,6 +1259,38 @@ tux64_mkrom_arguments_config_file_option_memory_display_identifiers [] = {
    }
 };
 
+static const struct Tux64String
+tux64_mkrom_arguments_config_file_option_pi_timing_identifiers [] = {
+   {
+      .ptr        = TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_IDENTIFIER,
+      .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_IDENTIFIER_CHARACTERS)
+   }
+};
+
+static const struct Tux64String
+tux64_mkrom_arguments_config_file_option_pi_timing_probe_identifiers [] = {
+   {
+      .ptr        = TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_PROBE_IDENTIFIER,
+      .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_PROBE_IDENTIFIER_CHARACTERS)
+   }
+};
+
+static const struct Tux64String
+tux64_mkrom_arguments_config_file_option_stats_display_identifiers [] = {
+   {
+      .ptr        = TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_STATS_DISPLAY_IDENTIFIER,
+      .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_STATS_DISPLAY_IDENTIFIER_CHARACTERS)
+   }
+};
+
+static const struct Tux64String
+tux64_mkrom_arguments_config_file_option_headless_identifiers [] = {
+   {
+      .ptr        = TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_HEADLESS_IDENTIFIER,
+      .characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_HEADLESS_IDENTIFIER_CHARACTERS)
+   }
+};
+
 static const struct Tux64String
 tux64_mkrom_arguments_config_file_option_rom_header_clock_rate_identifiers [] = {
    {
@@ -981,6 +1353,14 @@ tux64_mkrom_arguments_config_file_option_rom_header_game_code_identifiers [] = {
    TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_config_file_option_no_delay_identifiers)
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_MEMORY_DISPLAY_IDENTIFIERS_COUNT\
    TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_config_file_option_memory_display_identifiers)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_IDENTIFIERS_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_config_file_option_pi_timing_identifiers)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_PROBE_IDENTIFIERS_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_config_file_option_pi_timing_probe_identifiers)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_STATS_DISPLAY_IDENTIFIERS_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_config_file_option_stats_display_identifiers)
+#define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_HEADLESS_IDENTIFIERS_COUNT\
+   TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_config_file_option_headless_identifiers)
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_CLOCK_RATE_IDENTIFIERS_COUNT\
    TUX64_ARRAY_ELEMENTS(tux64_mkrom_arguments_config_file_option_rom_header_clock_rate_identifiers)
 #define TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_BOOT_ADDRESS_IDENTIFIERS_COUNT\
@@ -1098,6 +1478,34 @@ tux64_mkrom_arguments_config_file_options_optional [] = {
       .identifiers_short_count   = TUX64_LITERAL_UINT32(0u),
       .parser                    = tux64_mkrom_arguments_config_file_parser_memory_display
    },
+   {
+      .identifiers_long          = tux64_mkrom_arguments_config_file_option_pi_timing_identifiers,
+      .identifiers_short         = TUX64_NULLPTR,
+      .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_IDENTIFIERS_COUNT),
+      .identifiers_short_count   = TUX64_LITERAL_UINT32(0u),
+      .parser                    = tux64_mkrom_arguments_config_file_parser_pi_timing
+   },
+   {
+      .identifiers_long          = tux64_mkrom_arguments_config_file_option_pi_timing_probe_identifiers,
+      .identifiers_short         = TUX64_NULLPTR,
+      .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_PI_TIMING_PROBE_IDENTIFIERS_COUNT),
+      .identifiers_short_count   = TUX64_LITERAL_UINT32(0u),
+      .parser                    = tux64_mkrom_arguments_config_file_parser_pi_timing_probe
+   },
+   {
+      .identifiers_long          = tux64_mkrom_arguments_config_file_option_stats_display_identifiers,
+      .identifiers_short         = TUX64_NULLPTR,
+      .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_STATS_DISPLAY_IDENTIFIERS_COUNT),
+      .identifiers_short_count   = TUX64_LITERAL_UINT32(0u),
+      .parser                    = tux64_mkrom_arguments_config_file_parser_stats_display
+   },
+   {
+      .identifiers_long          = tux64_mkrom_arguments_config_file_option_headless_identifiers,
+      .identifiers_short         = TUX64_NULLPTR,
+      .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_HEADLESS_IDENTIFIERS_COUNT),
+      .identifiers_short_count   = TUX64_LITERAL_UINT32(0u),
+      .parser                    = tux64_mkrom_arguments_config_file_parser_headless
+   },
    {
       .identifiers_long          = tux64_mkrom_arguments_config_file_option_rom_header_clock_rate_identifiers,
       .identifiers_short         = TUX64_NULLPTR,
@@ -1260,6 +1668,7 @@ tux64_mkrom_arguments_config_file_initialize_optional(
    output->command_line.ptr = TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_COMMAND_LINE_DEFAULT_VALUE;
    output->command_line.characters = TUX64_LITERAL_UINT32(TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_COMMAND_LINE_DEFAULT_VALUE_CHARACTERS);
    output->boot_header_flags = TUX64_LITERAL_UINT32(0u);
+   output->pi_timing = *tux64_mkrom_arguments_pi_timing_profiles[0].timing;
 
    return;
 }
@@ -1281,7 +1690,7 @@ tux64_mkrom_arguments_config_file_parse(
    );
 }
 
-#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP\
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP_COMMAND_LINE\
    TUX64_MKROM_PACKAGE_NAME " - creates a bootable Nintendo 64 ROM image for Tux64\n"\
    "\n"\
    "COMMAND-LINE OPTIONS:\n"\
@@ -1299,6 +1708,20 @@ tux64_mkrom_arguments_config_file_parse(
    "      The path to prepend to all file paths in the configuration file.  File\n"\
    "      paths from the command-line will not have the prefix applied.\n"\
    "\n"\
+   "   " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_SHORT "u, " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_LONG "cache=[path], default=\"" TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_CACHE_DEFAULT_VALUE "\"\n"\
+   "\n"\
+   "      The path to a digest cache describing the ROM image at the output path.\n"\
+   "      If the cache matches the existing ROM image, it's updated in place and\n"\
+   "      only files which changed or moved since the last build are rewritten.\n"\
+   "      Otherwise, the ROM image is built from scratch.  Either way, the cache\n"\
+   "      is then updated to describe the new ROM image.  If empty, the ROM image\n"\
+   "      is always built from scratch and no cache is used.\n"\
+   "\n"\
+   "   " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_SHORT "j, " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_LONG "jobs=[count], default=\"" TUX64_MKROM_ARGUMENTS_COMMAND_LINE_OPTION_JOBS_DEFAULT_VALUE_STRING "\"\n"\
+   "\n"\
+   "      The number of threads used to read, checksum and write the input files\n"\
+   "      into the ROM image.  This should be a decimal number from 1 to 255.\n"\
+   "\n"\
    "   " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_SHORT "h, " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_SHORT "?, " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_LONG "help\n"\
    "\n"\
    "      Prints the program's help menu and usage information.\n"\
@@ -1306,7 +1729,10 @@ tux64_mkrom_arguments_config_file_parse(
    "   " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_SHORT "v, " TUX64_MKROM_ARGUMENTS_COMMAND_LINE_PREFIX_LONG "version\n"\
    "\n"\
    "      Prints the program's name and version.\n"\
-   "\n"\
+   "\n"
+
+/* split in two to stay under the string literal length limit of ISO C99 */
+#define TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP_CONFIG_FILE\
    "CONFIGURATION FILE:\n"\
    "\n"\
    "   Most of the boot parameters required to build the ROM image are stored in a\n"\
@@ -1369,6 +1795,30 @@ tux64_mkrom_arguments_config_file_parse(
    "\n"\
    "         Display memory usage information on startup\n"\
    "\n"\
+   "      --pi-timing=[profile], default=\"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL "\"\n"\
+   "\n"\
+   "         The PI domain 1 timing profile to apply before loading the boot\n"\
+   "         files.  \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_IPL "\" keeps the timings set up by the IPL,\n"\
+   "         \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_RETAIL "\" uses the timings of official cartridges, while\n"\
+   "         \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_FAST "\" and \"" TUX64_MKROM_ARGUMENTS_PI_TIMING_PROFILE_TURBO "\" are progressively faster and are only\n"\
+   "         supported by flashcarts with fast flash memory.\n"\
+   "\n"\
+   "      --pi-timing-probe, default is off\n"\
+   "\n"\
+   "         Verify ROM reads with the selected PI timing profile before using\n"\
+   "         it.  If verification fails, each slower profile is tried in turn,\n"\
+   "         falling back to the IPL timings if none of them work.\n"\
+   "\n"\
+   "      --stats-display, default is off\n"\
+   "\n"\
+   "         Display live load speed, bytes remaining, time remaining and\n"\
+   "         missed frames while loading boot files\n"\
+   "\n"\
+   "      --headless, default is off\n"\
+   "\n"\
+   "         Leave video output disabled and load the boot files as fast as\n"\
+   "         possible, starting the kernel as soon as they're loaded\n"\
+   "\n"\
    "      --rom-header-clock-rate=[value], default=\"" TUX64_MKROM_ARGUMENTS_CONFIG_FILE_OPTION_ROM_HEADER_CLOCK_RATE_DEFAULT_VALUE_STRING "\"\n"\
    "\n"\
    "         The clock rate field stored in the ROM header.  This has no effect\n"\
@@ -1416,8 +1866,12 @@ tux64_mkrom_arguments_command_line_print_menu(
 void
 tux64_mkrom_arguments_command_line_print_menu_help(void) {
    tux64_mkrom_arguments_command_line_print_menu(
-      TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP,
-      TUX64_LITERAL_UINT32(TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP) * sizeof(char))
+      TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP_COMMAND_LINE,
+      TUX64_LITERAL_UINT32(TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP_COMMAND_LINE) * sizeof(char))
+   );
+   tux64_mkrom_arguments_command_line_print_menu(
+      TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP_CONFIG_FILE,
+      TUX64_LITERAL_UINT32(TUX64_STRING_CHARACTERS(TUX64_MKROM_ARGUMENTS_COMMAND_LINE_MENU_HELP_CONFIG_FILE) * sizeof(char))
    );
    return;   
 }
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/*                          Copyright (C) Tux64 2025                          */
+/*                       Copyright (C) Tux64 2025, 2026                       */
 /*                    https://github.com/bradleycha/tux64                     */
 /*----------------------------------------------------------------------------*/
 /* mkrom/src/tux64-mkrom/arguments.h - Header for arguments parsing.          */
@@ -12,11 +12,14 @@
 #include "tux64-mkrom/tux64-mkrom.h"
 #include <tux64/arguments.h>
 #include <tux64/platform/mips/n64/rom.h>
+#include <tux64/platform/mips/n64/boot.h>
 
 struct Tux64MkromArgumentsCommandLine {
    struct Tux64String path_config;
    struct Tux64String path_output;
    struct Tux64String path_prefix;
+   struct Tux64String path_cache;
+   Tux64UInt8 jobs;
 };
 
 struct Tux64ArgumentsParseResult
@@ -36,6 +39,7 @@ struct Tux64MkromArgumentsConfigFile {
    struct Tux64String path_initramfs;
    struct Tux64String command_line;
    Tux64UInt32 boot_header_flags;
+   struct Tux64PlatformMipsN64BootHeaderPiTiming pi_timing;
 };
 
 extern const struct Tux64ArgumentsIteratorOptionsConfigFile
@@ -15,6 +15,7 @@
 #include <tux64/endian.h>
 #include <tux64/math.h>
 #include <tux64/checksum.h>
+#include "tux64-mkrom/jobs.h"
 
 /*----------------------------------------------------------------------------*/
 /* Here is the ROM layout we will be using, where '.' represents the current  */
@@ -39,7 +40,8 @@
 /*    Bootloader stage-2                                                      */
 /*                                                                            */
 /* . += input->files.bootloader.stage2.bytes:                                 */
-/*    Kernel image                                                            */
+/*    Kernel image, each segment's file data packed with up to 7 bytes of     */
+/*    padding to keep its alignment in memory                                 */
 /*                                                                            */
 /* . += input->files.kernel.bytes:                                            */
 /*    Initramfs image                                                         */
@@ -49,7 +51,8 @@
 /*----------------------------------------------------------------------------*/
 /* We also align all addresses to 2-byte boundaries.  PI DMA requires         */
 /* all RDRAM addresses to be 8-byte aligned, all PI addresses to be 2-byte    */
-/* aligned, and all byte counts to be 2-byte aligned.                         */
+/* aligned, and all byte counts to be 2-byte aligned.  Padding is never       */
+/* written, so it's left as holes in the output file.                         */
 /*                                                                            */
 /* Also note that all values must be big-endian, as that's the native         */
 /* endianess of the N64.                                                      */
@@ -74,6 +77,19 @@ tux64_mkrom_builder_align_value(
    );
 }
 
+/* the number of command line bytes stored in the ROM.  a command line with */
+/* only the null terminator isn't stored at all. */
+static Tux64UInt32
+tux64_mkrom_builder_command_line_bytes(
+   const struct Tux64MkromBuilderInput * input
+) {
+   if (input->kernel_command_line.characters == TUX64_LITERAL_UINT32(1u)) {
+      return TUX64_LITERAL_UINT32(0u);
+   }
+
+   return input->kernel_command_line.characters * TUX64_LITERAL_UINT32(sizeof(char));
+}
+
 /* makes sure we don't overflow a uint32 by adding all the aligned lengths */
 static struct Tux64MkromBuilderMeasureResult
 tux64_mkrom_builder_measure_and_verify_overflow(
@@ -111,11 +127,11 @@ tux64_mkrom_builder_measure_and_verify_overflow(
    }
    marker = tux64_mkrom_builder_align_value(marker + input->files.bootloader.stage2.bytes);
 
-   if (marker > TUX64_MKROM_BUILDER_ALIGNMENT_MAX_VALUE - input->files.kernel.image.bytes) {
+   if (marker > TUX64_MKROM_BUILDER_ALIGNMENT_MAX_VALUE - input->files.kernel.bytes) {
       result.status = TUX64_MKROM_BUILDER_MEASURE_STATUS_BAD_LENGTH_KERNEL;
       return result;
    }
-   marker = tux64_mkrom_builder_align_value(marker + input->files.kernel.image.bytes);
+   marker = tux64_mkrom_builder_align_value(marker + input->files.kernel.bytes);
 
    if (marker > TUX64_MKROM_BUILDER_ALIGNMENT_MAX_VALUE - input->files.initramfs.bytes) {
       result.status = TUX64_MKROM_BUILDER_MEASURE_STATUS_BAD_LENGTH_INITRAMFS;
@@ -123,7 +139,7 @@ tux64_mkrom_builder_measure_and_verify_overflow(
    }
    marker = tux64_mkrom_builder_align_value(marker + input->files.initramfs.bytes);
 
-   cmdline_bytes = input->kernel_command_line.characters * TUX64_LITERAL_UINT32(sizeof(char));
+   cmdline_bytes = tux64_mkrom_builder_command_line_bytes(input);
 
    if (cmdline_bytes > TUX64_UINT16_MAX) {
       result.status = TUX64_MKROM_BUILDER_MEASURE_STATUS_BAD_LENGTH_INITRAMFS;
@@ -164,6 +180,37 @@ tux64_mkrom_builder_calculate_checksum(
    return digest.uint;
 }
 
+static void
+tux64_mkrom_builder_initialize_boot_header_kernel_segments(
+   const struct Tux64MkromBuilderInputFileKernel * kernel,
+   struct Tux64PlatformMipsN64BootHeaderFileKernel * boot_header_kernel
+) {
+   const struct Tux64MkromBuilderInputFileKernelSegment * segment;
+   struct Tux64PlatformMipsN64BootHeaderKernelSegment * boot_header_segment;
+   Tux64UInt8 i;
+
+   boot_header_kernel->segment_count = tux64_mkrom_builder_store_item_uint32((Tux64UInt32)kernel->segment_count);
+
+   /* unused entries are left zeroed. */
+   for (i = TUX64_LITERAL_UINT8(0u); i < TUX64_LITERAL_UINT8(TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX); i++) {
+      boot_header_segment = &boot_header_kernel->segments[i];
+
+      if (i >= kernel->segment_count) {
+         boot_header_segment->offset = TUX64_LITERAL_UINT32(0u);
+         boot_header_segment->length = TUX64_LITERAL_UINT32(0u);
+         boot_header_segment->memory = TUX64_LITERAL_UINT32(0u);
+         continue;
+      }
+
+      segment = &kernel->segments[i];
+      boot_header_segment->offset = tux64_mkrom_builder_store_item_uint32(segment->addr_load - kernel->addr_load);
+      boot_header_segment->length = tux64_mkrom_builder_store_item_uint32(segment->image.bytes);
+      boot_header_segment->memory = tux64_mkrom_builder_store_item_uint32(segment->memory);
+   }
+
+   return;
+}
+
 static struct Tux64MkromBuilderMeasureResult
 tux64_mkrom_builder_measure_and_verify_initialize_boot_header(
    const struct Tux64MkromBuilderInput * input,
@@ -174,11 +221,7 @@ tux64_mkrom_builder_measure_and_verify_initialize_boot_header(
    Tux64UInt32 offset;
    union Tux64Int32 magic;
 
-   if (input->kernel_command_line.characters == TUX64_LITERAL_UINT32(1u)) {
-      cmdline_bytes = TUX64_LITERAL_UINT32(0u);
-   } else {
-      cmdline_bytes = input->kernel_command_line.characters * TUX64_LITERAL_UINT32(sizeof(char));
-   }
+   cmdline_bytes = tux64_mkrom_builder_command_line_bytes(input);
 
    offset = TUX64_LITERAL_UINT32(0x00001000u + sizeof(struct Tux64PlatformMipsN64BootHeader));
 
@@ -192,35 +235,41 @@ tux64_mkrom_builder_measure_and_verify_initialize_boot_header(
 
    boot_header->data.flags = tux64_mkrom_builder_store_item_uint32(input->boot_header_flags);
 
-   boot_header->data.files.bootloader.stage1.checksum = tux64_mkrom_builder_calculate_checksum(input->files.bootloader.stage1.data, input->files.bootloader.stage1.bytes);
+   /* checksums are filled in by tux64_mkrom_builder_construct() so every */
+   /* input is only read once. */
+   boot_header->data.files.bootloader.stage1.checksum = TUX64_LITERAL_UINT32(0u);
    boot_header->data.files.bootloader.stage1.length = tux64_mkrom_builder_store_item_uint32(input->files.bootloader.stage1.bytes);
    boot_header->data.files.bootloader.stage1.memory = tux64_mkrom_builder_store_item_uint32(input->files.bootloader.stage1.bytes + input->stage1_bss_length);
    offset += tux64_mkrom_builder_align_value(input->files.bootloader.stage1.bytes);
 
-   boot_header->data.files.bootloader.stage2.checksum = tux64_mkrom_builder_calculate_checksum(input->files.bootloader.stage2.data, input->files.bootloader.stage2.bytes);
+   boot_header->data.files.bootloader.stage2.checksum = TUX64_LITERAL_UINT32(0u);
    boot_header->data.files.bootloader.stage2.addr_cart = tux64_mkrom_builder_store_item_uint32(tux64_platform_mips_n64_pi_bus_address_dom1_rom(offset));
    boot_header->data.files.bootloader.stage2.length = tux64_mkrom_builder_store_item_uint32(input->files.bootloader.stage2.bytes);
    offset += tux64_mkrom_builder_align_value(input->files.bootloader.stage2.bytes);
 
-   boot_header->data.files.kernel.image.file.checksum = tux64_mkrom_builder_calculate_checksum(input->files.kernel.image.data, input->files.kernel.image.bytes);
+   boot_header->data.files.kernel.image.file.checksum = TUX64_LITERAL_UINT32(0u);
    boot_header->data.files.kernel.image.file.addr_cart = tux64_mkrom_builder_store_item_uint32(tux64_platform_mips_n64_pi_bus_address_dom1_rom(offset));
-   boot_header->data.files.kernel.image.file.length = tux64_mkrom_builder_store_item_uint32(input->files.kernel.image.bytes);
+   boot_header->data.files.kernel.image.file.length = tux64_mkrom_builder_store_item_uint32(input->files.kernel.bytes);
    boot_header->data.files.kernel.image.memory = tux64_mkrom_builder_store_item_uint32(input->files.kernel.memory);
    boot_header->data.files.kernel.addr_load = tux64_endian_convert_uint32(input->files.kernel.addr_load, TUX64_ENDIAN_FORMAT_BIG);
    boot_header->data.files.kernel.addr_entry = tux64_endian_convert_uint32(input->files.kernel.addr_entry, TUX64_ENDIAN_FORMAT_BIG);
-   offset += tux64_mkrom_builder_align_value(input->files.kernel.image.bytes);
+   tux64_mkrom_builder_initialize_boot_header_kernel_segments(&input->files.kernel, &boot_header->data.files.kernel);
+   offset += tux64_mkrom_builder_align_value(input->files.kernel.bytes);
 
-   boot_header->data.files.initramfs.checksum = tux64_mkrom_builder_calculate_checksum(input->files.initramfs.data, input->files.initramfs.bytes);
+   boot_header->data.files.initramfs.checksum = TUX64_LITERAL_UINT32(0u);
    boot_header->data.files.initramfs.addr_cart = tux64_mkrom_builder_store_item_uint32(tux64_platform_mips_n64_pi_bus_address_dom1_rom(offset));
    boot_header->data.files.initramfs.length = tux64_mkrom_builder_store_item_uint32(input->files.initramfs.bytes);
    offset += tux64_mkrom_builder_align_value(input->files.initramfs.bytes);
 
-   boot_header->data.files.command_line.checksum = tux64_mkrom_builder_calculate_checksum((const Tux64UInt8 *)input->kernel_command_line.ptr, input->kernel_command_line.characters * TUX64_LITERAL_UINT32(sizeof(char)));
+   boot_header->data.files.command_line.checksum = TUX64_LITERAL_UINT32(0u);
    boot_header->data.files.command_line.addr_cart = tux64_mkrom_builder_store_item_uint32(tux64_platform_mips_n64_pi_bus_address_dom1_rom(offset));
    boot_header->data.files.command_line.length = tux64_mkrom_builder_store_item_uint32(cmdline_bytes);
    offset += tux64_mkrom_builder_align_value(cmdline_bytes);
 
-   boot_header->checksum = tux64_mkrom_builder_calculate_checksum((const Tux64UInt8 *)&boot_header->data, TUX64_LITERAL_UINT32(sizeof(boot_header->data)));
+   /* each timing is a single byte, so there's no need for endian conversion. */
+   boot_header->data.pi_timing = input->pi_timing;
+
+   boot_header->checksum = TUX64_LITERAL_UINT32(0u);
 
    result.status = TUX64_MKROM_BUILDER_MEASURE_STATUS_OK;
    return result;
@@ -259,11 +308,7 @@ tux64_mkrom_builder_measure_and_verify(
       result.status = TUX64_MKROM_BUILDER_MEASURE_STATUS_BAD_LENGTH_BOOTLOADER_STAGE0_CIC;
    }
 
-   if (input->kernel_command_line.characters == TUX64_LITERAL_UINT32(1u)) {
-      cmdline_bytes = TUX64_LITERAL_UINT32(0u);
-   } else {
-      cmdline_bytes = (input->kernel_command_line.characters + TUX64_LITERAL_UINT32(1u)) * TUX64_LITERAL_UINT32(sizeof(char));
-   }
+   cmdline_bytes = tux64_mkrom_builder_command_line_bytes(input);
 
    /* begin measuring the size of the ROM.  we initialize to 0x1000 because */
    /* we always must have this due to the IPl2 expecting IPL3 in those bytes. */
@@ -282,7 +327,7 @@ tux64_mkrom_builder_measure_and_verify(
       return result;
    }
 
-   marker += tux64_mkrom_builder_align_value(input->files.kernel.image.bytes);
+   marker += tux64_mkrom_builder_align_value(input->files.kernel.bytes);
    if (marker > TUX64_MKROM_BUILDER_MAX_ROM_BYTES) {
       result.status = TUX64_MKROM_BUILDER_MEASURE_STATUS_BAD_LENGTH_KERNEL;
       return result;
@@ -308,100 +353,499 @@ tux64_mkrom_builder_measure_and_verify(
    return result;
 }
 
-void
+/* the number of bytes digested and written at a time.  this is small enough */
+/* for each chunk to still be cached when it's written after being digested. */
+#define TUX64_MKROM_BUILDER_STREAM_CHUNK_BYTES\
+   (256u * 1024u)
+
+struct Tux64MkromBuilderStream {
+   const struct Tux64FsWriter * output;
+   struct Tux64ChecksumContext checksum;
+   Tux64UInt32 offset;
+};
+
+static void
+tux64_mkrom_builder_stream_begin(
+   struct Tux64MkromBuilderStream * stream,
+   Tux64UInt32 offset
+) {
+   stream->offset = offset;
+   tux64_checksum_fletcher_64_32.initialize(&stream->checksum);
+   return;
+}
+
+static struct Tux64FsResult
+tux64_mkrom_builder_stream_write(
+   struct Tux64MkromBuilderStream * stream,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes
+) {
+   struct Tux64FsResult result;
+   Tux64UInt32 chunk_bytes;
+
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      chunk_bytes = bytes;
+      if (chunk_bytes > TUX64_LITERAL_UINT32(TUX64_MKROM_BUILDER_STREAM_CHUNK_BYTES)) {
+         chunk_bytes = TUX64_LITERAL_UINT32(TUX64_MKROM_BUILDER_STREAM_CHUNK_BYTES);
+      }
+
+      tux64_checksum_fletcher_64_32.digest(&stream->checksum, data, chunk_bytes);
+
+      result = tux64_fs_writer_write(stream->output, stream->offset, data, chunk_bytes);
+      if (result.status != TUX64_FS_STATUS_OK) {
+         return result;
+      }
+
+      data           += chunk_bytes;
+      stream->offset += chunk_bytes;
+      bytes          -= chunk_bytes;
+   }
+
+   result.status = TUX64_FS_STATUS_OK;
+   return result;
+}
+
+static Tux64UInt32
+tux64_mkrom_builder_checksum_end(
+   struct Tux64ChecksumContext * checksum
+) {
+   union Tux64Int32 digest;
+   Tux64UInt8 * digest_ptr;
+
+   digest_ptr = tux64_checksum_fletcher_64_32.finalize(checksum);
+
+   tux64_memory_copy(digest.bytes, digest_ptr, TUX64_LITERAL_UINT32(sizeof(digest)));
+
+   return digest.uint;
+}
+
+/* the kernel segments are stored back-to-back with their padding, so we */
+/* can digest them as if they were one contiguous file.  each segment can */
+/* need a part for its padding and another for its data. */
+struct Tux64MkromBuilderSection {
+   struct Tux64MkromBuilderInputFile parts [2u * TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX];
+   Tux64UInt8 part_count;
+   Tux64UInt32 offset;
+   Tux64UInt32 bytes;
+   const struct Tux64FsFileStamp * stamp;
+};
+
+/* sections are split into jobs of at most this many bytes so a large */
+/* initramfs or kernel can be spread across threads.  each job digests into */
+/* its own checksum context, which are merged back together in order, so */
+/* this must be a multiple of the checksum's merge alignment. */
+#define TUX64_MKROM_BUILDER_JOB_BYTES\
+   (4u * 1024u * 1024u)
+
+/* every section can end with one partial job */
+#define TUX64_MKROM_BUILDER_JOBS_MAX\
+   ((TUX64_MKROM_BUILDER_MAX_ROM_BYTES / TUX64_MKROM_BUILDER_JOB_BYTES) + TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT)
+
+struct Tux64MkromBuilderSectionJob {
+   const struct Tux64MkromBuilderSection * section;
+   enum Tux64MkromBuilderSectionIndex section_index;
+   Tux64UInt32 begin;
+   Tux64UInt32 bytes;
+   struct Tux64MkromBuilderStream stream;
+   struct Tux64FsResult result;
+};
+
+static Tux64UInt32
+tux64_mkrom_builder_section_initialize(
+   struct Tux64MkromBuilderSection * section,
+   Tux64UInt32 offset,
+   const Tux64UInt8 * data,
+   Tux64UInt32 bytes,
+   const struct Tux64FsFileStamp * stamp
+) {
+   section->parts[0].data  = data;
+   section->parts[0].bytes = bytes;
+   section->part_count     = TUX64_LITERAL_UINT8(1u);
+   section->offset         = offset;
+   section->bytes          = bytes;
+   section->stamp          = stamp;
+
+   return offset + tux64_mkrom_builder_align_value(bytes);
+}
+
+static const struct Tux64FsFileStamp *
+tux64_mkrom_builder_input_stamp(
+   const struct Tux64MkromBuilderInputStamp * stamp
+) {
+   if (stamp->valid == TUX64_BOOLEAN_FALSE) {
+      return TUX64_NULLPTR;
+   }
+
+   return &stamp->file;
+}
+
+static Tux64Boolean
+tux64_mkrom_builder_section_unchanged(
+   const struct Tux64MkromBuilderSection * section,
+   const struct Tux64MkromBuilderCacheSection * cached
+) {
+   if (section->stamp == TUX64_NULLPTR || cached->stamped == TUX64_LITERAL_UINT32(0u)) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   if (section->offset != cached->offset || section->bytes != cached->bytes) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return tux64_memory_compare_with_equal_lengths(
+      section->stamp,
+      &cached->stamp,
+      TUX64_LITERAL_UINT32(sizeof(struct Tux64FsFileStamp))
+   );
+}
+
+static const Tux64UInt8
+tux64_mkrom_builder_zeroes [0x1000u];
+
+/* when updating a ROM in place, padding may still hold stale data from */
+/* before a section shrank or moved.  it's zeroed so the result is identical */
+/* to a ROM built from scratch. */
+static struct Tux64FsResult
+tux64_mkrom_builder_write_zeroes(
+   const struct Tux64FsWriter * output,
+   Tux64UInt32 offset,
+   Tux64UInt32 bytes
+) {
+   struct Tux64FsResult result;
+   Tux64UInt32 chunk_bytes;
+
+   result.status = TUX64_FS_STATUS_OK;
+   while (bytes != TUX64_LITERAL_UINT32(0u)) {
+      chunk_bytes = bytes;
+      if (chunk_bytes > TUX64_LITERAL_UINT32(sizeof(tux64_mkrom_builder_zeroes))) {
+         chunk_bytes = TUX64_LITERAL_UINT32(sizeof(tux64_mkrom_builder_zeroes));
+      }
+
+      result = tux64_fs_writer_write(output, offset, tux64_mkrom_builder_zeroes, chunk_bytes);
+      if (result.status != TUX64_FS_STATUS_OK) {
+         return result;
+      }
+
+      offset += chunk_bytes;
+      bytes -= chunk_bytes;
+   }
+
+   return result;
+}
+
+static void
+tux64_mkrom_builder_section_job(
+   void * context
+) {
+   struct Tux64MkromBuilderSectionJob * job;
+   const struct Tux64MkromBuilderInputFile * part;
+   Tux64UInt32 job_end;
+   Tux64UInt32 part_begin;
+   Tux64UInt32 part_end;
+   Tux64UInt32 write_begin;
+   Tux64UInt32 write_end;
+   Tux64UInt8 i;
+
+   job = (struct Tux64MkromBuilderSectionJob *)context;
+   job_end = job->begin + job->bytes;
+
+   tux64_mkrom_builder_stream_begin(&job->stream, job->section->offset + job->begin);
+
+   /* write whichever parts of each file overlap with this job */
+   part_begin = TUX64_LITERAL_UINT32(0u);
+   for (i = TUX64_LITERAL_UINT8(0u); i < job->section->part_count; i++) {
+      part = &job->section->parts[i];
+      part_end = part_begin + part->bytes;
+
+      write_begin = part_begin;
+      if (write_begin < job->begin) {
+         write_begin = job->begin;
+      }
+      write_end = part_end;
+      if (write_end > job_end) {
+         write_end = job_end;
+      }
+
+      if (write_begin < write_end) {
+         job->result = tux64_mkrom_builder_stream_write(
+            &job->stream,
+            &part->data[write_begin - part_begin],
+            write_end - write_begin
+         );
+         if (job->result.status != TUX64_FS_STATUS_OK) {
+            return;
+         }
+      }
+
+      part_begin = part_end;
+   }
+
+   job->result.status = TUX64_FS_STATUS_OK;
+   return;
+}
+
+struct Tux64FsResult
 tux64_mkrom_builder_construct(
    const struct Tux64MkromBuilderInput * input,
    const struct Tux64MkromBuilderMeasurePayloadOk * measure_info,
-   Tux64UInt8 * output
+   const struct Tux64FsWriter * output,
+   const struct Tux64MkromBuilderCache * previous,
+   struct Tux64MkromBuilderCache * next
 ) {
+   struct Tux64FsResult result;
+   struct Tux64MkromBuilderSection sections [TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT];
+   struct Tux64ChecksumContext contexts [TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT];
+   Tux64UInt32 checksums [TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT];
+   Tux64Boolean reused [TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT];
+   struct Tux64MkromBuilderSectionJob section_jobs [TUX64_MKROM_BUILDER_JOBS_MAX];
+   struct Tux64MkromJob jobs [TUX64_MKROM_BUILDER_JOBS_MAX];
+   struct Tux64MkromBuilderSection * section;
+   struct Tux64MkromBuilderSection * kernel;
+   struct Tux64MkromBuilderSectionJob * job;
+   struct Tux64MkromBuilderCacheSection * next_section;
+   struct Tux64PlatformMipsN64BootHeader boot_header;
+   Tux64UInt32 offset;
+   Tux64UInt32 padding_begin;
+   Tux64UInt32 padding_end;
+   Tux64UInt32 job_count;
+   Tux64UInt32 job_begin;
+   Tux64UInt32 j;
+   Tux64UInt8 i;
    Tux64UInt8 sentinel_zero;
-   Tux64UInt8 * pen;
 
-   pen = output;
-
-   /* zero-initialize the entire ROM so we don't have to deal with residual */
-   sentinel_zero = TUX64_LITERAL_UINT8(0x00);
-   tux64_memory_fill(
-      output,
-      &sentinel_zero,
-      measure_info->rom_bytes,
-      TUX64_LITERAL_UINT32(sizeof(sentinel_zero))
-   );
+   /* the boot header is written last, since it holds the checksums of */
+   /* everything after it. */
+   tux64_memory_copy(&boot_header, &measure_info->boot_header, TUX64_LITERAL_UINT32(sizeof(boot_header)));
 
    /* ROM header */
-   tux64_memory_copy(
-      pen,
-      &input->rom_header,
+   result = tux64_fs_writer_write(
+      output,
+      TUX64_LITERAL_UINT32(0x00000000u),
+      (const Tux64UInt8 *)&input->rom_header,
       TUX64_LITERAL_UINT32(sizeof(struct Tux64PlatformMipsN64RomHeader))
    );
-   pen += sizeof(struct Tux64PlatformMipsN64RomHeader);
+   if (result.status != TUX64_FS_STATUS_OK) {
+      return result;
+   }
 
    /* stage-0 bootloader */
-   tux64_memory_copy(
-      pen,
+   result = tux64_fs_writer_write(
+      output,
+      TUX64_LITERAL_UINT32(sizeof(struct Tux64PlatformMipsN64RomHeader)),
       input->files.bootloader.stage0.data,
       input->files.bootloader.stage0.bytes
    );
+   if (result.status != TUX64_FS_STATUS_OK) {
+      return result;
+   }
 
-   pen = output + 0x1000 - input->files.bootloader.stage0_cic.bytes;
+   /* padding between stage-0 and its CIC data */
+   if (previous != TUX64_NULLPTR) {
+      result = tux64_mkrom_builder_write_zeroes(
+         output,
+         TUX64_LITERAL_UINT32(sizeof(struct Tux64PlatformMipsN64RomHeader)) + input->files.bootloader.stage0.bytes,
+         TUX64_LITERAL_UINT32(0x00001000u - sizeof(struct Tux64PlatformMipsN64RomHeader)) - input->files.bootloader.stage0.bytes - input->files.bootloader.stage0_cic.bytes
+      );
+      if (result.status != TUX64_FS_STATUS_OK) {
+         return result;
+      }
+   }
 
    /* stage-0 bootloader CIC data */
-   tux64_memory_copy(
-      pen,
+   result = tux64_fs_writer_write(
+      output,
+      TUX64_LITERAL_UINT32(0x00001000u) - input->files.bootloader.stage0_cic.bytes,
       input->files.bootloader.stage0_cic.data,
       input->files.bootloader.stage0_cic.bytes
    );
+   if (result.status != TUX64_FS_STATUS_OK) {
+      return result;
+   }
 
-   pen = output + 0x1000;
-
-   /* bootloader header */
-   tux64_memory_copy(
-      pen,
-      &measure_info->boot_header,
-      TUX64_LITERAL_UINT32(sizeof(struct Tux64PlatformMipsN64BootHeader))
-   );
-   pen += tux64_mkrom_builder_align_value(TUX64_LITERAL_UINT32(sizeof(struct Tux64PlatformMipsN64BootHeader)));
+   offset = TUX64_LITERAL_UINT32(0x00001000u);
+   offset += tux64_mkrom_builder_align_value(TUX64_LITERAL_UINT32(sizeof(struct Tux64PlatformMipsN64BootHeader)));
 
-   /* stage-1 bootloader */
-   tux64_memory_copy(
-      pen,
+   offset = tux64_mkrom_builder_section_initialize(
+      &sections[TUX64_MKROM_BUILDER_SECTION_INDEX_BOOTLOADER_STAGE1],
+      offset,
       input->files.bootloader.stage1.data,
-      input->files.bootloader.stage1.bytes
+      input->files.bootloader.stage1.bytes,
+      tux64_mkrom_builder_input_stamp(&input->stamps.stage1)
    );
-   pen += tux64_mkrom_builder_align_value(input->files.bootloader.stage1.bytes);
-
-   /* stage-2 bootloader */
-   tux64_memory_copy(
-      pen,
+   offset = tux64_mkrom_builder_section_initialize(
+      &sections[TUX64_MKROM_BUILDER_SECTION_INDEX_BOOTLOADER_STAGE2],
+      offset,
       input->files.bootloader.stage2.data,
-      input->files.bootloader.stage2.bytes
+      input->files.bootloader.stage2.bytes,
+      tux64_mkrom_builder_input_stamp(&input->stamps.stage2)
    );
-   pen += tux64_mkrom_builder_align_value(input->files.bootloader.stage2.bytes);
-   
-   /* kernel image */
-   tux64_memory_copy(
-      pen,
-      input->files.kernel.image.data,
-      input->files.kernel.image.bytes
-   );
-   pen += tux64_mkrom_builder_align_value(input->files.kernel.image.bytes);
 
-   /* initramfs */
-   tux64_memory_copy(
-      pen,
+   kernel = &sections[TUX64_MKROM_BUILDER_SECTION_INDEX_KERNEL];
+   kernel->part_count = TUX64_LITERAL_UINT8(0u);
+   kernel->offset     = offset;
+   kernel->bytes      = input->files.kernel.bytes;
+   kernel->stamp      = tux64_mkrom_builder_input_stamp(&input->stamps.kernel);
+   for (i = TUX64_LITERAL_UINT8(0u); i < input->files.kernel.segment_count; i++) {
+      if (input->files.kernel.segments[i].padding != TUX64_LITERAL_UINT32(0u)) {
+         kernel->parts[kernel->part_count].data  = tux64_mkrom_builder_zeroes;
+         kernel->parts[kernel->part_count].bytes = input->files.kernel.segments[i].padding;
+         kernel->part_count++;
+      }
+
+      kernel->parts[kernel->part_count] = input->files.kernel.segments[i].image;
+      kernel->part_count++;
+   }
+   offset += tux64_mkrom_builder_align_value(input->files.kernel.bytes);
+
+   offset = tux64_mkrom_builder_section_initialize(
+      &sections[TUX64_MKROM_BUILDER_SECTION_INDEX_INITRAMFS],
+      offset,
       input->files.initramfs.data,
-      input->files.initramfs.bytes
+      input->files.initramfs.bytes,
+      tux64_mkrom_builder_input_stamp(&input->stamps.initramfs)
+   );
+   (void)tux64_mkrom_builder_section_initialize(
+      &sections[TUX64_MKROM_BUILDER_SECTION_INDEX_COMMAND_LINE],
+      offset,
+      (const Tux64UInt8 *)input->kernel_command_line.ptr,
+      tux64_mkrom_builder_command_line_bytes(input),
+      TUX64_NULLPTR
    );
-   pen += tux64_mkrom_builder_align_value(input->files.initramfs.bytes);
 
-   /* kernel command-line */
-   tux64_memory_copy(
-      pen,
-      input->kernel_command_line.ptr,
-      input->kernel_command_line.characters * TUX64_LITERAL_UINT32(sizeof(char))
+   /* each job writes to its own region of the output, so they can all be */
+   /* read, digested and written at the same time.  empty sections still */
+   /* get a job so they have a checksum context to finalize. */
+   job_count = TUX64_LITERAL_UINT32(0u);
+   for (i = TUX64_LITERAL_UINT8(0u); i < TUX64_LITERAL_UINT8(TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT); i++) {
+      section = &sections[i];
+
+      reused[i] = TUX64_BOOLEAN_FALSE;
+      if (previous != TUX64_NULLPTR) {
+         reused[i] = tux64_mkrom_builder_section_unchanged(section, &previous->sections[i]);
+      }
+      if (reused[i] == TUX64_BOOLEAN_TRUE) {
+         checksums[i] = previous->sections[i].checksum;
+         continue;
+      }
+
+      if (previous != TUX64_NULLPTR) {
+         padding_end = measure_info->rom_bytes;
+         if (i != TUX64_LITERAL_UINT8(TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT - 1u)) {
+            padding_end = sections[i + 1u].offset;
+         }
+
+         /* the last section may run right up to the end of the ROM */
+         padding_begin = section->offset + section->bytes;
+         if (padding_begin > padding_end) {
+            padding_begin = padding_end;
+         }
+
+         result = tux64_mkrom_builder_write_zeroes(
+            output,
+            padding_begin,
+            padding_end - padding_begin
+         );
+         if (result.status != TUX64_FS_STATUS_OK) {
+            return result;
+         }
+      }
+
+      job_begin = TUX64_LITERAL_UINT32(0u);
+      do {
+         job = &section_jobs[job_count];
+         job->section         = section;
+         job->section_index   = (enum Tux64MkromBuilderSectionIndex)i;
+         job->begin           = job_begin;
+         job->bytes           = section->bytes - job_begin;
+         job->stream.output   = output;
+         if (job->bytes > TUX64_LITERAL_UINT32(TUX64_MKROM_BUILDER_JOB_BYTES)) {
+            job->bytes = TUX64_LITERAL_UINT32(TUX64_MKROM_BUILDER_JOB_BYTES);
+         }
+
+         jobs[job_count].function   = tux64_mkrom_builder_section_job;
+         jobs[job_count].context    = job;
+
+         job_begin += job->bytes;
+         job_count++;
+      } while (job_begin != section->bytes);
+   }
+
+   tux64_mkrom_jobs_run(jobs, job_count, input->jobs);
+
+   /* jobs are stored in ROM order, so each section's first job comes before */
+   /* the rest of its jobs, which are merged in order. */
+   for (j = TUX64_LITERAL_UINT32(0u); j < job_count; j++) {
+      job = &section_jobs[j];
+
+      if (job->result.status != TUX64_FS_STATUS_OK) {
+         return job->result;
+      }
+
+      if (job->begin == TUX64_LITERAL_UINT32(0u)) {
+         tux64_memory_copy(
+            &contexts[job->section_index],
+            &job->stream.checksum,
+            TUX64_LITERAL_UINT32(sizeof(struct Tux64ChecksumContext))
+         );
+         continue;
+      }
+
+      tux64_checksum_fletcher_64_32.merge(
+         &contexts[job->section_index],
+         &job->stream.checksum,
+         job->bytes
+      );
+   }
+
+   for (i = TUX64_LITERAL_UINT8(0u); i < TUX64_LITERAL_UINT8(TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT); i++) {
+      if (reused[i] == TUX64_BOOLEAN_FALSE) {
+         checksums[i] = tux64_mkrom_builder_checksum_end(&contexts[i]);
+      }
+   }
+
+   boot_header.data.files.bootloader.stage1.checksum  = checksums[TUX64_MKROM_BUILDER_SECTION_INDEX_BOOTLOADER_STAGE1];
+   boot_header.data.files.bootloader.stage2.checksum  = checksums[TUX64_MKROM_BUILDER_SECTION_INDEX_BOOTLOADER_STAGE2];
+   boot_header.data.files.kernel.image.file.checksum  = checksums[TUX64_MKROM_BUILDER_SECTION_INDEX_KERNEL];
+   boot_header.data.files.initramfs.checksum          = checksums[TUX64_MKROM_BUILDER_SECTION_INDEX_INITRAMFS];
+   boot_header.data.files.command_line.checksum       = checksums[TUX64_MKROM_BUILDER_SECTION_INDEX_COMMAND_LINE];
+
+   /* bootloader header */
+   boot_header.checksum = tux64_mkrom_builder_calculate_checksum((const Tux64UInt8 *)&boot_header.data, TUX64_LITERAL_UINT32(sizeof(boot_header.data)));
+
+   result = tux64_fs_writer_write(
+      output,
+      TUX64_LITERAL_UINT32(0x00001000u),
+      (const Tux64UInt8 *)&boot_header,
+      TUX64_LITERAL_UINT32(sizeof(boot_header))
    );
-   pen += tux64_mkrom_builder_align_value((input->kernel_command_line.characters + TUX64_LITERAL_UINT32(1u)) * TUX64_LITERAL_UINT32(sizeof(char)));
+   if (result.status != TUX64_FS_STATUS_OK) {
+      return result;
+   }
 
-   return;
-}
+   /* zero everything first so padding is consistent when stored as bytes */
+   sentinel_zero = TUX64_LITERAL_UINT8(0x00);
+   tux64_memory_fill(
+      next,
+      &sentinel_zero,
+      TUX64_LITERAL_UINT32(sizeof(*next)),
+      TUX64_LITERAL_UINT32(sizeof(sentinel_zero))
+   );
+
+   tux64_memory_copy(&next->boot_header, &boot_header, TUX64_LITERAL_UINT32(sizeof(boot_header)));
+   next->rom_bytes = measure_info->rom_bytes;
+
+   for (i = TUX64_LITERAL_UINT8(0u); i < TUX64_LITERAL_UINT8(TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT); i++) {
+      section = &sections[i];
+      next_section = &next->sections[i];
 
+      if (section->stamp != TUX64_NULLPTR) {
+         next_section->stamp = *section->stamp;
+         next_section->stamped = TUX64_LITERAL_UINT32(1u);
+      }
+      next_section->offset    = section->offset;
+      next_section->bytes     = section->bytes;
+      next_section->checksum  = checksums[i];
+   }
+
+   return result;
+}
@@ -12,6 +12,7 @@
 #include "tux64-mkrom/tux64-mkrom.h"
 #include <tux64/platform/mips/n64/boot.h>
 #include <tux64/platform/mips/n64/rom.h>
+#include <tux64/fs.h>
 
 #define TUX64_MKROM_BUILDER_MEASURE_STATUS_FIELD_COUNT 10u
 enum Tux64MkromBuilderMeasureStatus {
@@ -51,10 +52,23 @@ struct Tux64MkromBuilderInputFilesBootloader {
    struct Tux64MkromBuilderInputFile stage2;
 };
 
-struct Tux64MkromBuilderInputFileKernel {
+/* 'padding' is the number of zero bytes stored before the segment's image, */
+/* from tux64_platform_mips_n64_boot_kernel_segment_padding(). */
+struct Tux64MkromBuilderInputFileKernelSegment {
    struct Tux64MkromBuilderInputFile image;
    Tux64UInt32 memory;
    Tux64UInt32 addr_load;
+   Tux64UInt32 padding;
+};
+
+/* 'bytes' is the sum of every segment's padding and image length, and */
+/* 'memory' spans from 'addr_load' to the end of the last segment in memory. */
+struct Tux64MkromBuilderInputFileKernel {
+   struct Tux64MkromBuilderInputFileKernelSegment segments [TUX64_PLATFORM_MIPS_N64_BOOT_KERNEL_SEGMENTS_MAX];
+   Tux64UInt8 segment_count;
+   Tux64UInt32 bytes;
+   Tux64UInt32 memory;
+   Tux64UInt32 addr_load;
    Tux64UInt32 addr_entry;
 };
 
@@ -64,34 +78,96 @@ struct Tux64MkromBuilderInputFiles {
    struct Tux64MkromBuilderInputFile initramfs;
 };
 
+/* identifies an input file without reading it, so an unchanged file can be */
+/* skipped when updating an existing ROM image.  'valid' is false for files */
+/* which can't be stamped, such as pipes, which are always rewritten. */
+struct Tux64MkromBuilderInputStamp {
+   struct Tux64FsFileStamp file;
+   Tux64Boolean valid;
+};
+
+struct Tux64MkromBuilderInputStamps {
+   struct Tux64MkromBuilderInputStamp stage1;
+   struct Tux64MkromBuilderInputStamp stage2;
+   struct Tux64MkromBuilderInputStamp kernel;
+   struct Tux64MkromBuilderInputStamp initramfs;
+};
+
 struct Tux64MkromBuilderInput {
    struct Tux64MkromBuilderInputFiles files;
+   struct Tux64MkromBuilderInputStamps stamps;
    struct Tux64PlatformMipsN64RomHeader rom_header;
    struct Tux64String kernel_command_line;
    Tux64UInt32 boot_header_flags;
    Tux64UInt32 stage1_bss_length;
+   struct Tux64PlatformMipsN64BootHeaderPiTiming pi_timing;
+   Tux64UInt8 jobs;
 };
 
 /*----------------------------------------------------------------------------*/
 /* Measures how many bytes are required to create a ROM image.  This also     */
 /* verifies all components can fit into memory and performs other checks.     */
+/* The checksums in the returned boot header are left zeroed, as they're      */
+/* calculated while the ROM image is being written.                           */
 /*----------------------------------------------------------------------------*/
 struct Tux64MkromBuilderMeasureResult
 tux64_mkrom_builder_measure_and_verify(
    const struct Tux64MkromBuilderInput * input
 );
 
+/* every file after the boot header gets its own checksum, so each one can */
+/* be digested and written independently of the others. */
+enum Tux64MkromBuilderSectionIndex {
+   TUX64_MKROM_BUILDER_SECTION_INDEX_BOOTLOADER_STAGE1,
+   TUX64_MKROM_BUILDER_SECTION_INDEX_BOOTLOADER_STAGE2,
+   TUX64_MKROM_BUILDER_SECTION_INDEX_KERNEL,
+   TUX64_MKROM_BUILDER_SECTION_INDEX_INITRAMFS,
+   TUX64_MKROM_BUILDER_SECTION_INDEX_COMMAND_LINE,
+   TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT
+};
+
+/* 'stamped' is zero for sections which don't come from a file, which are */
+/* always rewritten. */
+struct Tux64MkromBuilderCacheSection {
+   struct Tux64FsFileStamp stamp;
+   Tux64UInt32 stamped;
+   Tux64UInt32 offset;
+   Tux64UInt32 bytes;
+   Tux64UInt32 checksum;
+};
+
+/* describes a ROM image exactly as it was written, including the digest of */
+/* every section, so a later build can tell which sections are unchanged */
+/* without reading them. */
+struct Tux64MkromBuilderCache {
+   struct Tux64PlatformMipsN64BootHeader boot_header;
+   Tux64UInt32 rom_bytes;
+   struct Tux64MkromBuilderCacheSection sections [TUX64_MKROM_BUILDER_SECTION_INDEX_COUNT];
+};
+
 /*----------------------------------------------------------------------------*/
 /* Constructs a ROM image after the input has been verified with              */
-/* tux64_mkrom_builder_measure_and_verify().  'output' should be the number   */
-/* of bytes return from the 'ok' variant of the previously mentioned          */
-/* function.                                                                  */
+/* tux64_mkrom_builder_measure_and_verify(), writing it to 'output'.          */
+/* 'output' should have been opened with the number of bytes returned from    */
+/* the 'ok' variant of the previously mentioned function.  Every input is     */
+/* read at most once.  Up to 'input->jobs' threads are used to read, digest   */
+/* and write the files after the boot header in parallel.                     */
+/*                                                                            */
+/* If 'previous' is NULL, 'output' is assumed to be zero-filled, and padding  */
+/* is never written.  Otherwise, 'output' is assumed to already contain the   */
+/* ROM image 'previous' describes.  Sections whose file stamp, offset and     */
+/* length are unchanged are neither read nor written, and their digests are   */
+/* taken from 'previous' instead.  Every other section is rewritten in place  */
+/* and its padding is zeroed, including sections which only moved.  In both   */
+/* cases, 'next' is filled out to describe the newly written ROM image.       */
 /*----------------------------------------------------------------------------*/
-void
+struct Tux64FsResult
 tux64_mkrom_builder_construct(
    const struct Tux64MkromBuilderInput * input,
    const struct Tux64MkromBuilderMeasurePayloadOk * measure_info,
-   Tux64UInt8 * output
+   const struct Tux64FsWriter * output,
+   const struct Tux64MkromBuilderCache * previous,
+   struct Tux64MkromBuilderCache * next
 );
 
 /*----------------------------------------------------------------------------*/
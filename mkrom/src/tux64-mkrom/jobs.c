@@ -0,0 +1,166 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* mkrom/src/tux64-mkrom/jobs.c - Implementations for running jobs in         */
+/*    parallel.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tux64-mkrom/tux64-mkrom.h"
+#include "tux64-mkrom/jobs.h"
+
+#define _TUX64_MKROM_JOBS_THREADS_ENABLE\
+   (TUX64_MKROM_HAVE_PTHREAD_H)
+
+#include <stddef.h>
+
+#if _TUX64_MKROM_JOBS_THREADS_ENABLE
+#include <pthread.h>
+#endif /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+
+struct Tux64MkromJobsQueue {
+   const struct Tux64MkromJob * jobs;
+   Tux64UInt32 job_count;
+   Tux64UInt32 job_next;
+#if _TUX64_MKROM_JOBS_THREADS_ENABLE
+   /* NULL if only the calling thread is taking jobs */
+   pthread_mutex_t * lock;
+#endif /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+};
+
+static const struct Tux64MkromJob *
+tux64_mkrom_jobs_queue_take(
+   struct Tux64MkromJobsQueue * queue
+) {
+   const struct Tux64MkromJob * job;
+
+#if _TUX64_MKROM_JOBS_THREADS_ENABLE
+   if (queue->lock != NULL) {
+      (void)pthread_mutex_lock(queue->lock);
+   }
+#endif /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+
+   job = NULL;
+   if (queue->job_next != queue->job_count) {
+      job = &queue->jobs[queue->job_next];
+      queue->job_next++;
+   }
+
+#if _TUX64_MKROM_JOBS_THREADS_ENABLE
+   if (queue->lock != NULL) {
+      (void)pthread_mutex_unlock(queue->lock);
+   }
+#endif /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+
+   return job;
+}
+
+static void
+tux64_mkrom_jobs_queue_drain(
+   struct Tux64MkromJobsQueue * queue
+) {
+   const struct Tux64MkromJob * job;
+
+   job = tux64_mkrom_jobs_queue_take(queue);
+   while (job != NULL) {
+      job->function(job->context);
+      job = tux64_mkrom_jobs_queue_take(queue);
+   }
+
+   return;
+}
+
+#if _TUX64_MKROM_JOBS_THREADS_ENABLE
+static void *
+tux64_mkrom_jobs_worker(
+   void * context
+) {
+   tux64_mkrom_jobs_queue_drain((struct Tux64MkromJobsQueue *)context);
+   return NULL;
+}
+
+static void
+tux64_mkrom_jobs_run_threaded(
+   struct Tux64MkromJobsQueue * queue,
+   Tux64UInt8 workers_count
+) {
+   pthread_t workers [TUX64_UINT8_MAX];
+   pthread_mutex_t lock;
+   Tux64UInt8 workers_started;
+
+   if (pthread_mutex_init(&lock, NULL) != 0) {
+      tux64_mkrom_jobs_queue_drain(queue);
+      return;
+   }
+   queue->lock = &lock;
+
+   /* if we run out of threads, whoever is already running picks up the */
+   /* slack, so there's no need to report it. */
+   workers_started = TUX64_LITERAL_UINT8(0u);
+   while (workers_started != workers_count) {
+      if (pthread_create(
+         &workers[workers_started],
+         NULL,
+         tux64_mkrom_jobs_worker,
+         queue
+      ) != 0) {
+         break;
+      }
+
+      workers_started++;
+   }
+
+   tux64_mkrom_jobs_queue_drain(queue);
+
+   while (workers_started != TUX64_LITERAL_UINT8(0u)) {
+      workers_started--;
+      (void)pthread_join(workers[workers_started], NULL);
+   }
+
+   queue->lock = NULL;
+   (void)pthread_mutex_destroy(&lock);
+   return;
+}
+#endif /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+
+void
+tux64_mkrom_jobs_run(
+   const struct Tux64MkromJob * jobs,
+   Tux64UInt32 job_count,
+   Tux64UInt8 threads
+) {
+   struct Tux64MkromJobsQueue queue;
+   Tux64UInt32 workers_count;
+
+   queue.jobs      = jobs;
+   queue.job_count = job_count;
+   queue.job_next  = TUX64_LITERAL_UINT32(0u);
+#if _TUX64_MKROM_JOBS_THREADS_ENABLE
+   queue.lock      = NULL;
+#endif /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+
+   /* the calling thread counts as a thread, and there's no point in */
+   /* starting threads which will never get a job. */
+   workers_count = TUX64_LITERAL_UINT32(0u);
+   if (threads > TUX64_LITERAL_UINT8(1u)) {
+      workers_count = threads - TUX64_LITERAL_UINT32(1u);
+   }
+   if (job_count != TUX64_LITERAL_UINT32(0u) && workers_count > job_count - TUX64_LITERAL_UINT32(1u)) {
+      workers_count = job_count - TUX64_LITERAL_UINT32(1u);
+   }
+
+#if _TUX64_MKROM_JOBS_THREADS_ENABLE
+   if (workers_count != TUX64_LITERAL_UINT32(0u)) {
+      tux64_mkrom_jobs_run_threaded(&queue, (Tux64UInt8)workers_count);
+      return;
+   }
+#else /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+   (void)workers_count;
+#endif /* _TUX64_MKROM_JOBS_THREADS_ENABLE */
+
+   tux64_mkrom_jobs_queue_drain(&queue);
+   return;
+}
+
@@ -0,0 +1,38 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* mkrom/src/tux64-mkrom/jobs.h - Header for running jobs in parallel.        */
+/*----------------------------------------------------------------------------*/
+
+#ifndef _TUX64_MKROM_JOBS_H
+#define _TUX64_MKROM_JOBS_H
+/*----------------------------------------------------------------------------*/
+
+#include "tux64-mkrom/tux64-mkrom.h"
+
+typedef void (*Tux64MkromJobFunction)(void * context);
+
+struct Tux64MkromJob {
+   Tux64MkromJobFunction function;
+   void * context;
+};
+
+/*----------------------------------------------------------------------------*/
+/* Runs every job in 'jobs' using up to 'threads' threads, including the      */
+/* calling thread, and returns once every job has finished.  Jobs are started */
+/* in order, so the longest jobs should come first.  Jobs may run at the same */
+/* time, so they must not share any mutable state.  If threads can't be       */
+/* created or threading isn't supported, the remaining jobs are run on the    */
+/* calling thread instead.                                                    */
+/*----------------------------------------------------------------------------*/
+void
+tux64_mkrom_jobs_run(
+   const struct Tux64MkromJob * jobs,
+   Tux64UInt32 job_count,
+   Tux64UInt8 threads
+);
+
+/*----------------------------------------------------------------------------*/
+#endif /* _TUX64_MKROM_JOBS_H */
+
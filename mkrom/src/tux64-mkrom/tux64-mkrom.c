@@ -132,11 +132,11 @@ tux64_mkrom_exit_result_display_parse_kernel_error(
       case TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_INVALID_MACHINE:
          TUX64_LOG_ERROR_FMT("kernel image is not for a MIPS processor, instead it's for machine 0x%08x", self->reason.payload.invalid_machine.machine);
          break;
-      case TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_MAIN_SEGMENT_MISSING:
+      case TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_SEGMENT_MISSING:
          TUX64_LOG_ERROR("kernel image does not contain any loadable segments");
          break;
-      case TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_MAIN_SEGMENT_DUPLICATE:
-         TUX64_LOG_ERROR("kernel image has more than one loadable segment, unable to choose the main segment");
+      case TUX64_PLATFORM_MIPS_N64_KERNEL_PARSE_STATUS_SEGMENT_OVERFLOW:
+         TUX64_LOG_ERROR_FMT("kernel image has more than %u loadable segments", TUX64_PLATFORM_MIPS_N64_KERNEL_SEGMENTS_MAX);
          break;
       default:
          TUX64_UNREACHABLE;
@@ -256,7 +256,7 @@ tux64_mkrom_exit_clean_list_free_entry_loaded_file(
    
    loaded_file = &entry->data.loaded_file;
 
-   tux64_fs_file_unload(loaded_file);
+   tux64_fs_file_unmap(loaded_file);
 
    return;
 }
@@ -375,22 +375,16 @@ tux64_mkrom_canonicalize_path_config_file(
 }
 
 static struct Tux64MkromExitResult
-tux64_mkrom_load_file(
-   const char * path_canonical,
-   const char * name,
+tux64_mkrom_exit_result_from_file_load_result(
+   const struct Tux64FsFileLoadResult * load_result,
    struct Tux64FsLoadedFile * output
 ) {
-   struct Tux64FsFileLoadResult load_result;
    struct Tux64MkromExitResult result;
 
-   TUX64_LOG_INFO_FMT("loading %s from %s", name, path_canonical);
-
-   load_result = tux64_fs_file_load(path_canonical);
-
-   switch (load_result.status) {
+   switch (load_result->status) {
       case TUX64_FS_STATUS_OK:
          result.status = TUX64_MKROM_EXIT_STATUS_OK;
-         *output = load_result.payload.ok;
+         *output = load_result->payload.ok;
          break;
 
       case TUX64_FS_STATUS_NOT_FOUND:
@@ -398,8 +392,8 @@ tux64_mkrom_load_file(
       case TUX64_FS_STATUS_NOT_A_FILE:
       case TUX64_FS_STATUS_UNKNOWN_ERROR:
          result.status = TUX64_MKROM_EXIT_STATUS_FS_ERROR;
-         result.payload.fs_error.reason.status = load_result.status;
-         result.payload.fs_error.reason.payload = load_result.payload.err;
+         result.payload.fs_error.reason.status = load_result->status;
+         result.payload.fs_error.reason.payload = load_result->payload.err;
          break;
 
       case TUX64_FS_STATUS_OUT_OF_MEMORY:
@@ -414,19 +408,12 @@ tux64_mkrom_load_file(
 }
 
 static struct Tux64MkromExitResult
-tux64_mkrom_save_file(
-   const char * path_canonical,
-   const char * name,
-   const struct Tux64FsLoadedFile * file
+tux64_mkrom_exit_result_from_fs_result(
+   const struct Tux64FsResult * fs_result
 ) {
-   struct Tux64FsResult save_result;
    struct Tux64MkromExitResult result;
 
-   TUX64_LOG_INFO_FMT("saving %s to %s", name, path_canonical);
-
-   save_result = tux64_fs_file_save(path_canonical, file);
-
-   switch (save_result.status) {
+   switch (fs_result->status) {
       case TUX64_FS_STATUS_OK:
          result.status = TUX64_MKROM_EXIT_STATUS_OK;
          break;
@@ -436,7 +423,7 @@ tux64_mkrom_save_file(
       case TUX64_FS_STATUS_NOT_A_FILE:
       case TUX64_FS_STATUS_UNKNOWN_ERROR:
          result.status = TUX64_MKROM_EXIT_STATUS_FS_ERROR;
-         result.payload.fs_error.reason = save_result;
+         result.payload.fs_error.reason = *fs_result;
          break;
 
       case TUX64_FS_STATUS_OUT_OF_MEMORY:
@@ -451,51 +438,89 @@ tux64_mkrom_save_file(
 }
 
 static struct Tux64MkromExitResult
-tux64_mkrom_load_file_command_line(
-   const struct Tux64String * path,
+tux64_mkrom_map_file(
+   const char * path_canonical,
    const char * name,
-   struct Tux64FsLoadedFile * output
+   struct Tux64FsLoadedFile * output,
+   struct Tux64MkromBuilderInputStamp * stamp
+) {
+   struct Tux64FsFileLoadResult load_result;
+   struct Tux64FsResult stamp_result;
+
+   TUX64_LOG_INFO_FMT("mapping %s from %s", name, path_canonical);
+
+   /* stamp before mapping, so if the file is modified while we're reading */
+   /* it, the next build will see it as changed.  if stamping fails, either */
+   /* mapping will fail too, or it's something like a pipe which we can */
+   /* still read, but have to rewrite every time. */
+   if (stamp != TUX64_NULLPTR) {
+      stamp_result = tux64_fs_file_stamp(path_canonical, &stamp->file);
+      stamp->valid = (stamp_result.status == TUX64_FS_STATUS_OK);
+   }
+
+   load_result = tux64_fs_file_map(path_canonical);
+
+   return tux64_mkrom_exit_result_from_file_load_result(&load_result, output);
+}
+
+static struct Tux64MkromExitResult
+tux64_mkrom_open_file(
+   const char * path_canonical,
+   const char * name,
+   Tux64UInt32 bytes,
+   Tux64Boolean existing,
+   struct Tux64FsWriter * output
 ) {
+   struct Tux64FsWriterOpenResult open_result;
+   struct Tux64FsResult fs_result;
    struct Tux64MkromExitResult result;
-   char * path_canonical;
 
-   path_canonical = tux64_mkrom_canonicalize_path_command_line(path);
-   if (path_canonical == TUX64_NULLPTR) {
-      result.status = TUX64_MKROM_EXIT_STATUS_OUT_OF_MEMORY;
+   if (existing == TUX64_BOOLEAN_TRUE) {
+      TUX64_LOG_INFO_FMT("updating %s at %s", name, path_canonical);
+      open_result = tux64_fs_writer_open_existing(path_canonical, bytes);
+   } else {
+      TUX64_LOG_INFO_FMT("saving %s to %s", name, path_canonical);
+      open_result = tux64_fs_writer_open(path_canonical, bytes);
+   }
+   if (open_result.status == TUX64_FS_STATUS_OK) {
+      *output = open_result.payload.ok;
+      result.status = TUX64_MKROM_EXIT_STATUS_OK;
       return result;
    }
 
-   result = tux64_mkrom_load_file(path_canonical, name, output);
-   free(path_canonical);
-   return result;
+   fs_result.status = open_result.status;
+   fs_result.payload = open_result.payload.err;
+   return tux64_mkrom_exit_result_from_fs_result(&fs_result);
 }
 
 static struct Tux64MkromExitResult
-tux64_mkrom_save_file_command_line(
+tux64_mkrom_map_file_command_line(
    const struct Tux64String * path,
    const char * name,
-   const struct Tux64FsLoadedFile * file
+   struct Tux64FsLoadedFile * output
 ) {
    struct Tux64MkromExitResult result;
+   struct Tux64FsResult fs_result;
    char * path_canonical;
 
    path_canonical = tux64_mkrom_canonicalize_path_command_line(path);
    if (path_canonical == TUX64_NULLPTR) {
-      result.status = TUX64_MKROM_EXIT_STATUS_OUT_OF_MEMORY;
-      return result;
+      fs_result.status = TUX64_FS_STATUS_OUT_OF_MEMORY;
+      return tux64_mkrom_exit_result_from_fs_result(&fs_result);
    }
 
-   result = tux64_mkrom_save_file(path_canonical, name, file);
+   result = tux64_mkrom_map_file(path_canonical, name, output, TUX64_NULLPTR);
    free(path_canonical);
    return result;
 }
 
 static struct Tux64MkromExitResult
-tux64_mkrom_load_file_config_file(
+tux64_mkrom_map_file_config_file(
    const struct Tux64String * prefix,
    const struct Tux64String * path,
    const char * name,
-   struct Tux64FsLoadedFile * output
+   struct Tux64FsLoadedFile * output,
+   struct Tux64MkromBuilderInputStamp * stamp
 ) {
    struct Tux64MkromExitResult result;
    char * path_canonical;
@@ -506,11 +531,137 @@ tux64_mkrom_load_file_config_file(
       return result;
    }
 
-   result = tux64_mkrom_load_file(path_canonical, name, output);
+   result = tux64_mkrom_map_file(path_canonical, name, output, stamp);
    free(path_canonical);
    return result;
 }
 
+#define TUX64_MKROM_CACHE_MAGIC\
+   "tux64-mkrom-cache"
+#define TUX64_MKROM_CACHE_MAGIC_CHARACTERS\
+   TUX64_STRING_CHARACTERS(TUX64_MKROM_CACHE_MAGIC)
+
+/* bump this whenever the layout of the cache changes.  since the cache is */
+/* stored as raw bytes, it's only valid on the machine which created it. */
+#define TUX64_MKROM_CACHE_VERSION\
+   (1u)
+
+struct Tux64MkromCacheFile {
+   char magic [TUX64_MKROM_CACHE_MAGIC_CHARACTERS];
+   Tux64UInt32 version;
+   struct Tux64MkromBuilderCache cache;
+};
+
+/* returns TUX64_BOOLEAN_FALSE if there's no cache, or if the cache doesn't */
+/* describe the ROM image at 'path_output', in which case the ROM image must */
+/* be built from scratch. */
+static Tux64Boolean
+tux64_mkrom_cache_load(
+   const char * path_cache,
+   const char * path_output,
+   struct Tux64MkromBuilderCache * output
+) {
+   struct Tux64FsFileLoadResult load_result;
+   struct Tux64FsLoadedFile file;
+   const struct Tux64MkromCacheFile * cache_file;
+   Tux64Boolean valid;
+
+   TUX64_LOG_INFO_FMT("loading ROM cache from %s", path_cache);
+
+   load_result = tux64_fs_file_load(path_cache);
+   if (load_result.status != TUX64_FS_STATUS_OK) {
+      TUX64_LOG_INFO("no usable ROM cache, building ROM image from scratch");
+      return TUX64_BOOLEAN_FALSE;
+   }
+   file = load_result.payload.ok;
+
+   cache_file = (const struct Tux64MkromCacheFile *)file.data;
+   valid = (
+      file.bytes == TUX64_LITERAL_UINT32(sizeof(struct Tux64MkromCacheFile)) &&
+      tux64_memory_compare_with_equal_lengths(
+         cache_file->magic,
+         TUX64_MKROM_CACHE_MAGIC,
+         TUX64_LITERAL_UINT32(TUX64_MKROM_CACHE_MAGIC_CHARACTERS * sizeof(char))
+      ) == TUX64_BOOLEAN_TRUE &&
+      cache_file->version == TUX64_LITERAL_UINT32(TUX64_MKROM_CACHE_VERSION)
+   );
+   if (valid == TUX64_BOOLEAN_TRUE) {
+      tux64_memory_copy(output, &cache_file->cache, TUX64_LITERAL_UINT32(sizeof(*output)));
+   }
+
+   tux64_fs_file_unload(&file);
+
+   if (valid == TUX64_BOOLEAN_FALSE) {
+      TUX64_LOG_WARNING("ROM cache is corrupt or outdated, building ROM image from scratch");
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   /* the boot header holds the checksum of every section, so if it matches, */
+   /* the ROM image is almost certainly the one the cache describes. */
+   load_result = tux64_fs_file_map(path_output);
+   if (load_result.status != TUX64_FS_STATUS_OK) {
+      TUX64_LOG_INFO("no existing ROM image, building ROM image from scratch");
+      return TUX64_BOOLEAN_FALSE;
+   }
+   file = load_result.payload.ok;
+
+   valid = (
+      file.bytes == output->rom_bytes &&
+      file.bytes >= TUX64_LITERAL_UINT32(0x00001000u + sizeof(output->boot_header)) &&
+      tux64_memory_compare_with_equal_lengths(
+         &file.data[0x00001000u],
+         &output->boot_header,
+         TUX64_LITERAL_UINT32(sizeof(output->boot_header))
+      ) == TUX64_BOOLEAN_TRUE
+   );
+
+   tux64_fs_file_unmap(&file);
+
+   if (valid == TUX64_BOOLEAN_FALSE) {
+      TUX64_LOG_WARNING("existing ROM image doesn't match ROM cache, building ROM image from scratch");
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   return TUX64_BOOLEAN_TRUE;
+}
+
+/* if 'cache' is NULL, the cache is emptied so it can't match any ROM image */
+static struct Tux64FsResult
+tux64_mkrom_cache_save(
+   const char * path_cache,
+   const struct Tux64MkromBuilderCache * cache
+) {
+   struct Tux64MkromCacheFile cache_file;
+   struct Tux64FsLoadedFile file;
+   Tux64UInt8 sentinel_zero;
+
+   file.data = (Tux64UInt8 *)&cache_file;
+   file.bytes = TUX64_LITERAL_UINT32(0u);
+
+   if (cache != TUX64_NULLPTR) {
+      TUX64_LOG_INFO_FMT("saving ROM cache to %s", path_cache);
+
+      sentinel_zero = TUX64_LITERAL_UINT8(0x00);
+      tux64_memory_fill(
+         &cache_file,
+         &sentinel_zero,
+         TUX64_LITERAL_UINT32(sizeof(cache_file)),
+         TUX64_LITERAL_UINT32(sizeof(sentinel_zero))
+      );
+      tux64_memory_copy(
+         cache_file.magic,
+         TUX64_MKROM_CACHE_MAGIC,
+         TUX64_LITERAL_UINT32(TUX64_MKROM_CACHE_MAGIC_CHARACTERS * sizeof(char))
+      );
+      cache_file.version = TUX64_LITERAL_UINT32(TUX64_MKROM_CACHE_VERSION);
+      tux64_memory_copy(&cache_file.cache, cache, TUX64_LITERAL_UINT32(sizeof(*cache)));
+
+      file.bytes = TUX64_LITERAL_UINT32(sizeof(cache_file));
+   }
+
+   return tux64_fs_file_save(path_cache, &file);
+}
+
 struct Tux64MkromInputFilesBootloader {
    struct Tux64FsLoadedFile stage0;
    struct Tux64FsLoadedFile stage0_cic;
@@ -523,8 +674,17 @@ struct Tux64MkromInputFilesKernelImage {
    Tux64UInt32 bytes;
 };
 
+struct Tux64MkromInputFilesKernelSegment {
+   struct Tux64MkromInputFilesKernelImage image;
+   Tux64UInt32 memory;
+   Tux64UInt32 addr_load;
+   Tux64UInt32 padding;
+};
+
 struct Tux64MkromInputFilesKernel {
-   struct Tux64MkromInputFilesKernelImage image;  
+   struct Tux64MkromInputFilesKernelSegment segments [TUX64_PLATFORM_MIPS_N64_KERNEL_SEGMENTS_MAX];
+   Tux64UInt8 segment_count;
+   Tux64UInt32 bytes;
    Tux64UInt32 memory;
    Tux64UInt32 addr_load;
    Tux64UInt32 addr_entry;
@@ -538,11 +698,15 @@ struct Tux64MkromInputFiles {
 
 struct Tux64MkromInput {
    struct Tux64MkromInputFiles files;
+   struct Tux64MkromBuilderInputStamps stamps;
    const struct Tux64PlatformMipsN64RomHeader * rom_header;
    struct Tux64String kernel_command_line;
    struct Tux64String path_output;
+   struct Tux64String path_cache;
    Tux64UInt32 boot_header_flags;
    Tux64UInt32 stage1_bss_length;
+   struct Tux64PlatformMipsN64BootHeaderPiTiming pi_timing;
+   Tux64UInt8 jobs;
 };
 
 static struct Tux64MkromExitResult
@@ -552,8 +716,14 @@ tux64_mkrom_run_parsed_input(
    struct Tux64MkromExitResult result;
    struct Tux64MkromBuilderInput builder_input;
    struct Tux64MkromBuilderMeasureResult measure_result;
-   Tux64UInt8 * rom_file_data;
-   struct Tux64FsLoadedFile rom_file;
+   struct Tux64FsWriter rom_file;
+   struct Tux64FsResult fs_result;
+   struct Tux64MkromBuilderCache cache_previous;
+   struct Tux64MkromBuilderCache cache_next;
+   const struct Tux64MkromBuilderCache * previous;
+   char * path_output;
+   char * path_cache;
+   Tux64UInt8 i;
 
    /* we do this to restrict mutable pointers and also work around previous */
    /* bad code, and I don't feel like rewriting it because it's boring. */
@@ -565,8 +735,15 @@ tux64_mkrom_run_parsed_input(
    builder_input.files.bootloader.stage1.bytes = input->files.bootloader.stage1.bytes;
    builder_input.files.bootloader.stage2.data = input->files.bootloader.stage2.data;
    builder_input.files.bootloader.stage2.bytes = input->files.bootloader.stage2.bytes;
-   builder_input.files.kernel.image.data = input->files.kernel.image.data;
-   builder_input.files.kernel.image.bytes = input->files.kernel.image.bytes;
+   for (i = TUX64_LITERAL_UINT8(0u); i < input->files.kernel.segment_count; i++) {
+      builder_input.files.kernel.segments[i].image.data = input->files.kernel.segments[i].image.data;
+      builder_input.files.kernel.segments[i].image.bytes = input->files.kernel.segments[i].image.bytes;
+      builder_input.files.kernel.segments[i].memory = input->files.kernel.segments[i].memory;
+      builder_input.files.kernel.segments[i].addr_load = input->files.kernel.segments[i].addr_load;
+      builder_input.files.kernel.segments[i].padding = input->files.kernel.segments[i].padding;
+   }
+   builder_input.files.kernel.segment_count = input->files.kernel.segment_count;
+   builder_input.files.kernel.bytes = input->files.kernel.bytes;
    builder_input.files.kernel.memory = input->files.kernel.memory;
    builder_input.files.kernel.addr_load = input->files.kernel.addr_load;
    builder_input.files.kernel.addr_entry = input->files.kernel.addr_entry;
@@ -576,6 +753,9 @@ tux64_mkrom_run_parsed_input(
    builder_input.kernel_command_line = input->kernel_command_line;
    builder_input.boot_header_flags = input->boot_header_flags;
    builder_input.stage1_bss_length = input->stage1_bss_length;
+   builder_input.pi_timing = input->pi_timing;
+   builder_input.stamps = input->stamps;
+   builder_input.jobs = input->jobs;
 
    TUX64_LOG_INFO("verifying input files and calculating ROM length");
 
@@ -588,29 +768,73 @@ tux64_mkrom_run_parsed_input(
 
    TUX64_LOG_INFO_FMT("ROM will be %" PRIu32 " bytes", measure_result.payload.ok.rom_bytes);
 
-   rom_file_data = malloc(measure_result.payload.ok.rom_bytes * sizeof(Tux64UInt8));
-   if (rom_file_data == NULL) {
+   path_output = tux64_mkrom_canonicalize_path_command_line(&input->path_output);
+   if (path_output == TUX64_NULLPTR) {
       result.status = TUX64_MKROM_EXIT_STATUS_OUT_OF_MEMORY;
       return result;
    }
 
-   rom_file.data = rom_file_data;
-   rom_file.bytes = measure_result.payload.ok.rom_bytes;
+   path_cache = TUX64_NULLPTR;
+   previous = TUX64_NULLPTR;
+   if (input->path_cache.characters != TUX64_LITERAL_UINT32(0u)) {
+      path_cache = tux64_mkrom_canonicalize_path_command_line(&input->path_cache);
+      if (path_cache == TUX64_NULLPTR) {
+         result.status = TUX64_MKROM_EXIT_STATUS_OUT_OF_MEMORY;
+         goto exit0;
+      }
+
+      if (tux64_mkrom_cache_load(path_cache, path_output, &cache_previous) == TUX64_BOOLEAN_TRUE) {
+         previous = &cache_previous;
+      }
+
+      /* a failed build can leave the ROM image only partially updated, so */
+      /* the cache is emptied until the new ROM image is complete. */
+      fs_result = tux64_mkrom_cache_save(path_cache, TUX64_NULLPTR);
+      result = tux64_mkrom_exit_result_from_fs_result(&fs_result);
+      if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
+         goto exit1;
+      }
+   }
+
+   result = tux64_mkrom_open_file(
+      path_output,
+      "ROM image",
+      measure_result.payload.ok.rom_bytes,
+      (previous != TUX64_NULLPTR),
+      &rom_file
+   );
+   if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
+      goto exit1;
+   }
 
    TUX64_LOG_INFO("constructing ROM image");
 
-   tux64_mkrom_builder_construct(
+   /* the ROM is streamed straight from the mapped inputs to the output */
+   /* file, so we never hold a copy of the whole ROM in memory. */
+   fs_result = tux64_mkrom_builder_construct(
       &builder_input,
       &measure_result.payload.ok,
-      rom_file.data
+      &rom_file,
+      previous,
+      &cache_next
    );
+   result = tux64_mkrom_exit_result_from_fs_result(&fs_result);
 
-   result = tux64_mkrom_save_file_command_line(
-      &input->path_output,
-      "ROM image",
-      &rom_file
-   );
-   tux64_fs_file_unload(&rom_file);
+   /* still report errors from closing, such as running out of disk space */
+   fs_result = tux64_fs_writer_close(&rom_file);
+   if (result.status == TUX64_MKROM_EXIT_STATUS_OK) {
+      result = tux64_mkrom_exit_result_from_fs_result(&fs_result);
+   }
+
+   if (result.status == TUX64_MKROM_EXIT_STATUS_OK && path_cache != TUX64_NULLPTR) {
+      fs_result = tux64_mkrom_cache_save(path_cache, &cache_next);
+      result = tux64_mkrom_exit_result_from_fs_result(&fs_result);
+   }
+
+exit1:
+   free(path_cache);
+exit0:
+   free(path_output);
    return result;
 }
 
@@ -632,11 +856,12 @@ tux64_mkrom_run_parsed_cmdline(
    struct Tux64PlatformMipsN64KernelParseResult kernel_elf_parse_result;
    struct Tux64PlatformMipsN64Kernel * kernel;
    char * kernel_command_line_ptr;
+   Tux64UInt8 i;
    Tux64Boolean config_file_loaded;
    Tux64Boolean stage1_bss_file_loaded;
 
    /* attempt to load the config file into memory */
-   result = tux64_mkrom_load_file_command_line(
+   result = tux64_mkrom_map_file_command_line(
       &cmdline->path_config,
       "config file",
       &config_file
@@ -680,66 +905,73 @@ tux64_mkrom_run_parsed_cmdline(
    }
 
    /* load all the files into memory */
-   result = tux64_mkrom_load_file_config_file(
+   result = tux64_mkrom_map_file_config_file(
       &cmdline->path_prefix,
       &config_file_parsed.path_bootloader_stage0,
       "bootloader stage-0 code",
-      &input.files.bootloader.stage0
+      &input.files.bootloader.stage0,
+      TUX64_NULLPTR
    );
    if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
       goto load_err_exit0;
    }
-   result = tux64_mkrom_load_file_config_file(
+   result = tux64_mkrom_map_file_config_file(
       &cmdline->path_prefix,
       &config_file_parsed.path_bootloader_stage0_cic,
       "bootloader stage-0 CIC data",
-      &input.files.bootloader.stage0_cic
+      &input.files.bootloader.stage0_cic,
+      TUX64_NULLPTR
    );
    if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
       goto load_err_exit1;
    }
-   result = tux64_mkrom_load_file_config_file(
+   result = tux64_mkrom_map_file_config_file(
       &cmdline->path_prefix,
       &config_file_parsed.path_bootloader_stage1,
       "bootloader stage-1 code",
-      &input.files.bootloader.stage1
+      &input.files.bootloader.stage1,
+      &input.stamps.stage1
    );
    if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
       goto load_err_exit2;
    }
-   result = tux64_mkrom_load_file_config_file(
+   result = tux64_mkrom_map_file_config_file(
       &cmdline->path_prefix,
       &config_file_parsed.path_bootloader_stage1_bss,
       "bootloader stage-1 BSS length",
-      &stage1_bss_file
+      &stage1_bss_file,
+      TUX64_NULLPTR
    );
    if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
       goto load_err_exit3;
    }
    stage1_bss_file_loaded = TUX64_BOOLEAN_TRUE;
-   result = tux64_mkrom_load_file_config_file(
+   result = tux64_mkrom_map_file_config_file(
       &cmdline->path_prefix,
       &config_file_parsed.path_bootloader_stage2,
       "bootloader stage-2 code",
-      &input.files.bootloader.stage2
+      &input.files.bootloader.stage2,
+      &input.stamps.stage2
    );
    if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
       goto load_err_exit4;
    }
-   result = tux64_mkrom_load_file_config_file(
+   result = tux64_mkrom_map_file_config_file(
       &cmdline->path_prefix,
       &config_file_parsed.path_kernel,
       "kernel image",
-      &kernel_elf_file
+      &kernel_elf_file,
+      &input.stamps.kernel
    );
    if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
       goto load_err_exit5;
    }
-   result = tux64_mkrom_load_file_config_file(
+   result = tux64_mkrom_map_file_config_file(
       &cmdline->path_prefix,
       &config_file_parsed.path_initramfs,
       "initramfs image",
-      &input.files.initramfs
+      &input.files.initramfs,
+      &input.stamps.initramfs
    );
    if (result.status != TUX64_MKROM_EXIT_STATUS_OK) {
       goto load_err_exit6;
@@ -768,7 +1000,7 @@ tux64_mkrom_run_parsed_cmdline(
    );
 
    /* free the stage-1 BSS length file as we don't need it anymore */
-   tux64_fs_file_unload(&stage1_bss_file);
+   tux64_fs_file_unmap(&stage1_bss_file);
    stage1_bss_file_loaded = TUX64_BOOLEAN_FALSE;
 
    /* bail if parsing the length failed */
@@ -778,7 +1010,7 @@ tux64_mkrom_run_parsed_cmdline(
       goto load_err_exit8;
    }
 
-   /* attempt to parse the kernel elf into its main segment and load metadata */
+   /* attempt to parse the kernel elf into its segments and load metadata */
    kernel_elf_parse_result = tux64_platform_mips_n64_kernel_parse(
       kernel_elf_file.data,
       kernel_elf_file.bytes
@@ -790,10 +1022,17 @@ tux64_mkrom_run_parsed_cmdline(
    }
    kernel = &kernel_elf_parse_result.payload.ok;
 
-   /* unwrap the parsed kernel image since we pass a straight pointer instead */
-   /* of a file offset.*/
-   input.files.kernel.image.data = &kernel_elf_file.data[kernel->image.offset];
-   input.files.kernel.image.bytes = kernel->image.bytes;
+   /* unwrap the parsed kernel segments since we pass a straight pointer */
+   /* instead of a file offset.*/
+   for (i = TUX64_LITERAL_UINT8(0u); i < kernel->segment_count; i++) {
+      input.files.kernel.segments[i].image.data = &kernel_elf_file.data[kernel->segments[i].offset];
+      input.files.kernel.segments[i].image.bytes = kernel->segments[i].bytes;
+      input.files.kernel.segments[i].memory = kernel->segments[i].memory;
+      input.files.kernel.segments[i].addr_load = kernel->segments[i].addr_load;
+      input.files.kernel.segments[i].padding = kernel->segments[i].padding;
+   }
+   input.files.kernel.segment_count = kernel->segment_count;
+   input.files.kernel.bytes = kernel->image_bytes;
    input.files.kernel.memory = kernel->memory;
    input.files.kernel.addr_load = kernel->addr_load;
    input.files.kernel.addr_entry = kernel->addr_entry;
@@ -803,10 +1042,13 @@ tux64_mkrom_run_parsed_cmdline(
    input.kernel_command_line.ptr = kernel_command_line_ptr;
    input.kernel_command_line.characters = config_file_parsed.command_line.characters + TUX64_LITERAL_UINT32(1u);
    input.path_output = cmdline->path_output;
+   input.path_cache = cmdline->path_cache;
    input.boot_header_flags = config_file_parsed.boot_header_flags;
+   input.pi_timing = config_file_parsed.pi_timing;
+   input.jobs = cmdline->jobs;
 
    /* we can now safely free the config file since all data is owned */
-   tux64_fs_file_unload(&config_file);
+   tux64_fs_file_unmap(&config_file);
    config_file_loaded = TUX64_BOOLEAN_FALSE;
 
    /* and now we commence to the actual program, hoo-ray... */
@@ -816,24 +1058,24 @@ tux64_mkrom_run_parsed_cmdline(
 load_err_exit8:
    free(kernel_command_line_ptr);
 load_err_exit7:
-   tux64_fs_file_unload(&input.files.initramfs);
+   tux64_fs_file_unmap(&input.files.initramfs);
 load_err_exit6:
-   tux64_fs_file_unload(&kernel_elf_file);
+   tux64_fs_file_unmap(&kernel_elf_file);
 load_err_exit5:
-   tux64_fs_file_unload(&input.files.bootloader.stage2);
+   tux64_fs_file_unmap(&input.files.bootloader.stage2);
 load_err_exit4:
    if (stage1_bss_file_loaded == TUX64_BOOLEAN_TRUE) {
-      tux64_fs_file_unload(&stage1_bss_file);
+      tux64_fs_file_unmap(&stage1_bss_file);
    }
 load_err_exit3:
-   tux64_fs_file_unload(&input.files.bootloader.stage1);
+   tux64_fs_file_unmap(&input.files.bootloader.stage1);
 load_err_exit2:
-   tux64_fs_file_unload(&input.files.bootloader.stage0_cic);
+   tux64_fs_file_unmap(&input.files.bootloader.stage0_cic);
 load_err_exit1:
-   tux64_fs_file_unload(&input.files.bootloader.stage0);
+   tux64_fs_file_unmap(&input.files.bootloader.stage0);
 load_err_exit0:
    if (config_file_loaded == TUX64_BOOLEAN_TRUE) {
-      tux64_fs_file_unload(&config_file);
+      tux64_fs_file_unmap(&config_file);
    }
    return result;
 }
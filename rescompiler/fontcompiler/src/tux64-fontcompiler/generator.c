@@ -22,7 +22,7 @@
    )
 #define TUX64_FONTCOMPILER_GENERATOR_INPUT_RGB888_BYTES_PER_PIXEL 3u
 
-#define TUX64_FONTCOMPILER_GENERATOR_CHARACTERS_VERTICAL    4u
+#define TUX64_FONTCOMPILER_GENERATOR_CHARACTERS_VERTICAL    5u
 #define TUX64_FONTCOMPILER_GENERATOR_CHARACTERS_HORIZONTAL  16u
 #define TUX64_FONTCOMPILER_GENERATOR_CHARACTERS \
    ( \
@@ -163,7 +163,7 @@ tux64_fontcompiler_main_parsed_args(
       return result;
    }
 
-   input_file_load_result = tux64_fs_file_load(path_input_cstr);
+   input_file_load_result = tux64_fs_file_map(path_input_cstr);
    free(path_input_cstr);
 
    switch (input_file_load_result.status) {
@@ -194,7 +194,7 @@ tux64_fontcompiler_main_parsed_args(
       input_file_load_result.payload.ok.bytes,
       &args->name
    );
-   tux64_fs_file_unload(&input_file_load_result.payload.ok);
+   tux64_fs_file_unmap(&input_file_load_result.payload.ok);
 
    switch (generator_parse_result.status) {
       case TUX64_FONTCOMPILER_GENERATOR_PARSE_STATUS_OK:
@@ -173,7 +173,7 @@ tux64_imagecompiler_main_parsed_args(
       return result;
    }
 
-   input_file_load_result = tux64_fs_file_load(path_input_cstr);
+   input_file_load_result = tux64_fs_file_map(path_input_cstr);
    free(path_input_cstr);
 
    switch (input_file_load_result.status) {
@@ -202,7 +202,7 @@ tux64_imagecompiler_main_parsed_args(
       &tux64_imagecompiler_image_encoded
    );
 
-   tux64_fs_file_unload(&input_file_load_result.payload.ok);
+   tux64_fs_file_unmap(&input_file_load_result.payload.ok);
 
    switch (image_encode_status) {
       case TUX64_IMAGECOMPILER_ENCODER_STATUS_OK:
@@ -282,8 +282,8 @@ tux64_imagecompiler_main_parsed_args(
       case TUX64_FS_STATUS_NOT_A_FILE:
       case TUX64_FS_STATUS_UNKNOWN_ERROR:
          result.status = TUX64_IMAGECOMPILER_EXIT_STATUS_FS_ERROR;
-         result.payload.fs_error.reason.status = input_file_load_result.status;
-         result.payload.fs_error.reason.payload = input_file_load_result.payload.err;
+         result.payload.fs_error.reason.status = output_file_save_result.status;
+         result.payload.fs_error.reason.payload = output_file_save_result.payload;
          return result;
       default:
          TUX64_UNREACHABLE;
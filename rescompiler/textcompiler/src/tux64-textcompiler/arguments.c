@@ -60,6 +60,21 @@ tux64_textcompiler_arguments_parser_path_output(
    );
 }
 
+static struct Tux64ArgumentsParseOptionResult
+tux64_textcompiler_arguments_parser_name(
+   const struct Tux64String * parameter,
+   void * context
+) {
+   struct Tux64TextCompilerArguments * arguments;
+
+   arguments = (struct Tux64TextCompilerArguments *)context;
+
+   return tux64_textcompiler_arguments_parser_string(
+      parameter,
+      &arguments->name
+   );
+}
+
 static struct Tux64ArgumentsParseOptionResult
 tux64_textcompiler_arguments_parser_help(
    const struct Tux64String * parameter,
@@ -106,6 +121,10 @@ tux64_textcompiler_arguments_parser_version(
    "output"
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_OUTPUT_IDENTIFIER_SHORT \
    'o'
+#define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIER_LONG \
+   "name"
+#define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIER_SHORT \
+   'n'
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_HELP_IDENTIFIER_LONG \
    "help"
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_HELP_IDENTIFIER_SHORT_A \
@@ -121,6 +140,8 @@ tux64_textcompiler_arguments_parser_version(
    TUX64_STRING_CHARACTERS(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_INPUT_IDENTIFIER_LONG)
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_OUTPUT_IDENTIFIER_LONG_CHARACTERS \
    TUX64_STRING_CHARACTERS(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_OUTPUT_IDENTIFIER_LONG)
+#define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIER_LONG_CHARACTERS \
+   TUX64_STRING_CHARACTERS(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIER_LONG)
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_HELP_IDENTIFIER_LONG_CHARACTERS \
    TUX64_STRING_CHARACTERS(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_HELP_IDENTIFIER_LONG)
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_VERSION_IDENTIFIER_LONG_CHARACTERS \
@@ -149,6 +170,17 @@ tux64_textcompiler_arguments_option_path_output_identifiers_short [] = {
    TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_OUTPUT_IDENTIFIER_SHORT
 };
 static const struct Tux64String
+tux64_textcompiler_arguments_option_name_identifiers_long [] = {
+   {
+      .ptr        = TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIER_LONG,
+      .characters = TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIER_LONG_CHARACTERS)
+   }
+};
+static const char
+tux64_textcompiler_arguments_option_name_identifiers_short [] = {
+   TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIER_SHORT
+};
+static const struct Tux64String
 tux64_textcompiler_arguments_option_help_identifiers_long [] = {
    {
       .ptr        = TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_HELP_IDENTIFIER_LONG,
@@ -180,6 +212,10 @@ tux64_textcompiler_arguments_option_version_identifiers_short [] = {
    TUX64_ARRAY_ELEMENTS(tux64_textcompiler_arguments_option_path_output_identifiers_long)
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_OUTPUT_IDENTIFIERS_SHORT_COUNT \
    TUX64_ARRAY_ELEMENTS(tux64_textcompiler_arguments_option_path_output_identifiers_short)
+#define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIERS_LONG_COUNT \
+   TUX64_ARRAY_ELEMENTS(tux64_textcompiler_arguments_option_name_identifiers_long)
+#define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIERS_SHORT_COUNT \
+   TUX64_ARRAY_ELEMENTS(tux64_textcompiler_arguments_option_name_identifiers_short)
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_HELP_IDENTIFIERS_LONG_COUNT \
    TUX64_ARRAY_ELEMENTS(tux64_textcompiler_arguments_option_help_identifiers_long)
 #define TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_HELP_IDENTIFIERS_SHORT_COUNT \
@@ -204,6 +240,13 @@ tux64_textcompiler_arguments_options_required [] = {
       .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_OUTPUT_IDENTIFIERS_LONG_COUNT),
       .identifiers_short_count   = TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_PATH_OUTPUT_IDENTIFIERS_SHORT_COUNT),
       .parser                    = tux64_textcompiler_arguments_parser_path_output
+   },
+   {
+      .identifiers_long          = tux64_textcompiler_arguments_option_name_identifiers_long,
+      .identifiers_short         = tux64_textcompiler_arguments_option_name_identifiers_short,
+      .identifiers_long_count    = TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIERS_LONG_COUNT),
+      .identifiers_short_count   = TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_ARGUMENTS_OPTION_NAME_IDENTIFIERS_SHORT_COUNT),
+      .parser                    = tux64_textcompiler_arguments_parser_name
    }
 };
 
@@ -285,7 +328,9 @@ tux64_textcompiler_arguments_parse(
    "   This program is used by tux64-boot to encode ASCII text into the embedded form\n" \
    "   used in the stage-1 bootloader's framebuffer console.  It takes as input a\n" \
    "   file containing all strings and identifiers, and outputs C source code which\n" \
-   "   defines all the data required for each text string.\n" \
+   "   defines all the data required for each text string.  Every string is stored\n" \
+   "   in a single string pool, where identical strings are merged and strings are\n" \
+   "   overlapped wherever one is contained within, or continues from, another.\n" \
    "\n" \
    "COMMAND-LINE OPTIONS:\n" \
    "\n" \
@@ -298,6 +343,17 @@ tux64_textcompiler_arguments_parse(
    "\n" \
    "      The path to the output C source code.\n" \
    "\n" \
+   "   " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_SHORT "n, " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_LONG "name=[string]\n" \
+   "\n" \
+   "      The identifier for a preprocessor #define which includes the byte data\n" \
+   "      for the string pool.  This byte data can be used to define an array as\n" \
+   "      follows, given an identifier of \"STRING_POOL\":\n" \
+   "\n" \
+   "         static const Tux64UInt8\n" \
+   "         string_pool [] = {\n" \
+   "            STRING_POOL\n" \
+   "         };\n" \
+   "\n" \
    "   " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_SHORT "h, " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_SHORT "?, " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_LONG "help\n" \
    "\n" \
    "      Prints the program's help menu and usage information.\n" \
@@ -315,13 +371,13 @@ tux64_textcompiler_arguments_parse(
    "\n" \
    "      {\n" \
    "         /* here is the first entry into our string table! */\n" \
-   "         .identifier_data    = HELLO_WORLD_DATA;\n" \
+   "         .identifier_data    = HELLO_WORLD_OFFSET;\n" \
    "         .identifier_length  = HELLO_WORLD_LENGTH;\n" \
    "         .text               = \"Hello world\";\n" \
    "      }\n" \
    "      {\n" \
    "         /* here is another entry as well! */\n" \
-   "         .identifier_data    = FORMATTED_DATA;\n" \
+   "         .identifier_data    = FORMATTED_OFFSET;\n" \
    "         .identifier_length  = FORMATTED_LENGTH;\n" \
    "         .text               = \"w a t...\";\n" \
    "      }\n" \
@@ -333,14 +389,12 @@ tux64_textcompiler_arguments_parse(
    "\n" \
    "      .identifier_data=[label]\n" \
    "\n" \
-   "         The identifier for a preprocessor #define which includes the byte data\n" \
-   "         for the string.  This byte data can be used to define an array as\n" \
-   "         follows, given an identifier of \"HELLO_WORLD_DATA\":\n" \
+   "         The identifier for a preprocessor #define which defines an integer\n" \
+   "         which represents the offset of the string's byte data into the string\n" \
+   "         pool, in bytes.  Given an identifier of \"HELLO_WORLD_OFFSET\", the\n" \
+   "         string can be found as follows:\n" \
    "\n" \
-   "            static const Tux64UInt8\n" \
-   "            hello_world_data [] = {\n" \
-   "               HELLO_WORLD_DATA\n" \
-   "            };\n" \
+   "            &string_pool[HELLO_WORLD_OFFSET]\n" \
    "\n" \
    "      .identifier_length=[label]\n" \
    "\n" \
@@ -364,7 +418,7 @@ tux64_textcompiler_arguments_parse(
    "\n" \
    "EXAMPLE USAGE:\n" \
    "\n" \
-   "   " TUX64_TEXTCOMPILER_PACKAGE_NAME " " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_LONG "input=strings.txt " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_LONG "output=strings.bin.c\n" \
+   "   " TUX64_TEXTCOMPILER_PACKAGE_NAME " " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_LONG "input=strings.txt " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_LONG "output=strings.bin.c " TUX64_TEXTCOMPILER_ARGUMENTS_PREFIX_LONG "name=STRING_POOL\n" \
    "\n"
 
 #define TUX64_TEXTCOMPILER_ARGUMENTS_MENU_VERSION \
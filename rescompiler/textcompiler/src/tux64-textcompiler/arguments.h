@@ -16,6 +16,7 @@
 struct Tux64TextCompilerArguments {
    struct Tux64String path_input;
    struct Tux64String path_output;
+   struct Tux64String name;
 };
 
 struct Tux64ArgumentsParseResult
@@ -50,6 +50,8 @@
 
 #define TUX64_TEXTCOMPILER_FORMATTER_INTEGER_DIGITS_COUNT \
    2u /* formatted as 2 hexits for a single byte */
+#define TUX64_TEXTCOMPILER_FORMATTER_OFFSET_DIGITS_COUNT \
+   8u /* formatted as 8 hexits for a 32-bit word */
 
 #define TUX64_TEXTCOMPILER_FORMATTER_CHARACTERS_PER_BYTE_NEWLINE \
    ( \
@@ -64,6 +66,209 @@
       TUX64_TEXTCOMPILER_FORMATTER_BYTE_SUFFIX_FINAL_CHARACTERS \
    )
 
+/*----------------------------------------------------------------------------*/
+/* every string is placed into a single pool of characters, and each string   */
+/* is then described by its offset into the pool.  strings are placed longest */
+/* first, so any string which is contained within another string, including   */
+/* identical strings and shared suffixes, is found inside the pool and takes  */
+/* up no extra space.  otherwise, the string is appended to the pool, reusing */
+/* the longest tail of the pool which matches the start of the string.        */
+/*----------------------------------------------------------------------------*/
+
+struct Tux64TextCompilerFormatterPool {
+   char * data;
+   Tux64UInt32 characters;
+   Tux64UInt32 * offsets; /* one for each string, in the same order */
+};
+
+static int
+tux64_textcompiler_formatter_pool_order_compare(
+   const void * a,
+   const void * b
+) {
+   const struct Tux64TextCompilerLexerString * string_a;
+   const struct Tux64TextCompilerLexerString * string_b;
+
+   string_a = *(const struct Tux64TextCompilerLexerString * const *)a;
+   string_b = *(const struct Tux64TextCompilerLexerString * const *)b;
+
+   /* longest first, falling back to the order in the text file so the */
+   /* output doesn't depend on the sort implementation. */
+   if (string_a->text.characters != string_b->text.characters) {
+      return (int)string_b->text.characters - (int)string_a->text.characters;
+   }
+   if (string_a < string_b) {
+      return -1;
+   }
+   if (string_a > string_b) {
+      return 1;
+   }
+
+   return 0;
+}
+
+static Tux64Boolean
+tux64_textcompiler_formatter_pool_find(
+   const struct Tux64TextCompilerFormatterPool * pool,
+   const struct Tux64TextCompilerLexerText * text,
+   Tux64UInt32 * offset
+) {
+   Tux64UInt32 i;
+   const char * iter_data;
+
+   if (pool->characters < text->characters) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   i = pool->characters - text->characters + TUX64_LITERAL_UINT32(1u);
+   iter_data = pool->data;
+   while (i != TUX64_LITERAL_UINT32(0u)) {
+      if (tux64_memory_compare_with_equal_lengths(
+         iter_data,
+         text->ptr,
+         text->characters * TUX64_LITERAL_UINT32(sizeof(char))
+      ) == TUX64_BOOLEAN_TRUE) {
+         *offset = (Tux64UInt32)(iter_data - pool->data);
+         return TUX64_BOOLEAN_TRUE;
+      }
+
+      iter_data++;
+      i--;
+   }
+
+   return TUX64_BOOLEAN_FALSE;
+}
+
+static Tux64UInt32
+tux64_textcompiler_formatter_pool_overlap(
+   const struct Tux64TextCompilerFormatterPool * pool,
+   const struct Tux64TextCompilerLexerText * text
+) {
+   Tux64UInt32 overlap;
+
+   /* the string was already searched for, so it can't overlap completely. */
+   overlap = text->characters - TUX64_LITERAL_UINT32(1u);
+   if (overlap > pool->characters) {
+      overlap = pool->characters;
+   }
+
+   while (overlap != TUX64_LITERAL_UINT32(0u)) {
+      if (tux64_memory_compare_with_equal_lengths(
+         &pool->data[pool->characters - overlap],
+         text->ptr,
+         overlap * TUX64_LITERAL_UINT32(sizeof(char))
+      ) == TUX64_BOOLEAN_TRUE) {
+         break;
+      }
+
+      overlap--;
+   }
+
+   return overlap;
+}
+
+static Tux64UInt32
+tux64_textcompiler_formatter_pool_insert(
+   struct Tux64TextCompilerFormatterPool * pool,
+   const struct Tux64TextCompilerLexerText * text
+) {
+   Tux64UInt32 offset;
+   Tux64UInt32 overlap;
+
+   if (tux64_textcompiler_formatter_pool_find(pool, text, &offset) == TUX64_BOOLEAN_TRUE) {
+      return offset;
+   }
+
+   overlap = tux64_textcompiler_formatter_pool_overlap(pool, text);
+   offset = pool->characters - overlap;
+
+   tux64_memory_copy(
+      &pool->data[pool->characters],
+      &text->ptr[overlap],
+      (text->characters - overlap) * TUX64_LITERAL_UINT32(sizeof(char))
+   );
+   pool->characters += text->characters - overlap;
+
+   return offset;
+}
+
+static Tux64Boolean
+tux64_textcompiler_formatter_pool_build(
+   const struct Tux64TextCompilerLexerStringArray * string_array,
+   struct Tux64TextCompilerFormatterPool * pool
+) {
+   const struct Tux64TextCompilerLexerString ** order;
+   const struct Tux64TextCompilerLexerString ** iter_order;
+   const struct Tux64TextCompilerLexerString * iter_string_array;
+   Tux64UInt32 characters_total;
+   Tux64UInt32 i;
+
+   characters_total = TUX64_LITERAL_UINT32(0u);
+
+   order = (const struct Tux64TextCompilerLexerString **)malloc(string_array->length * sizeof(const struct Tux64TextCompilerLexerString *));
+   if (order == NULL) {
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   i = string_array->length;
+   iter_order = order;
+   iter_string_array = string_array->ptr;
+   do {
+      *iter_order = iter_string_array;
+      characters_total += iter_string_array->text.characters;
+
+      iter_order++;
+      iter_string_array++;
+      i--;
+   } while (i != TUX64_LITERAL_UINT32(0u));
+
+   pool->data = (char *)malloc(characters_total * sizeof(char));
+   if (pool->data == NULL) {
+      free(order);
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   pool->offsets = (Tux64UInt32 *)malloc(string_array->length * sizeof(Tux64UInt32));
+   if (pool->offsets == NULL) {
+      free(pool->data);
+      free(order);
+      return TUX64_BOOLEAN_FALSE;
+   }
+
+   pool->characters = TUX64_LITERAL_UINT32(0u);
+
+   qsort(
+      order,
+      (size_t)string_array->length,
+      sizeof(const struct Tux64TextCompilerLexerString *),
+      tux64_textcompiler_formatter_pool_order_compare
+   );
+
+   i = string_array->length;
+   iter_order = order;
+   do {
+      pool->offsets[*iter_order - string_array->ptr] = tux64_textcompiler_formatter_pool_insert(
+         pool,
+         &(*iter_order)->text
+      );
+
+      iter_order++;
+      i--;
+   } while (i != TUX64_LITERAL_UINT32(0u));
+
+   free(order);
+   return TUX64_BOOLEAN_TRUE;
+}
+
+static void
+tux64_textcompiler_formatter_pool_free(
+   struct Tux64TextCompilerFormatterPool * pool
+) {
+   free(pool->offsets);
+   free(pool->data);
+   return;
+}
+
 static Tux64UInt32
 tux64_textcompiler_formatter_calculate_output_length_preprocessor_define(
    const struct Tux64String * identifier
@@ -80,19 +285,19 @@ tux64_textcompiler_formatter_calculate_output_length_preprocessor_define(
 }
 
 static Tux64UInt32
-tux64_textcompiler_formatter_calculate_output_length_item_string_data(
+tux64_textcompiler_formatter_calculate_output_length_item_pool_data(
    const struct Tux64String * identifier,
-   Tux64UInt8 characters
+   Tux64UInt32 characters
 ) {
    Tux64UInt32 retn;
-   Tux64UInt8 bytes;
+   Tux64UInt32 bytes;
 
    retn = TUX64_LITERAL_UINT32(0u);
 
-   bytes = (characters * TUX64_LITERAL_UINT8(sizeof(char)));
+   bytes = (characters * TUX64_LITERAL_UINT32(sizeof(char)));
 
    retn += tux64_textcompiler_formatter_calculate_output_length_preprocessor_define(identifier);
-   retn += (Tux64UInt32)(bytes - TUX64_LITERAL_UINT8(1u)) * TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_CHARACTERS_PER_BYTE_NEWLINE);
+   retn += (bytes - TUX64_LITERAL_UINT32(1u)) * TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_CHARACTERS_PER_BYTE_NEWLINE);
    retn += TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_CHARACTERS_PER_BYTE_FINAL);
 
    return retn;
@@ -100,7 +305,8 @@ tux64_textcompiler_formatter_calculate_output_length_item_string_data(
 
 static Tux64UInt32
 tux64_textcompiler_formatter_calculate_output_length_item_integer(
-   const struct Tux64String * identifier
+   const struct Tux64String * identifier,
+   Tux64UInt32 digits
 ) {
    Tux64UInt32 retn;
 
@@ -108,7 +314,7 @@ tux64_textcompiler_formatter_calculate_output_length_item_integer(
 
    retn += tux64_textcompiler_formatter_calculate_output_length_preprocessor_define(identifier);
    retn += TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_INTEGER_PREFIX_CHARACTERS);
-   retn += TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_INTEGER_DIGITS_COUNT);
+   retn += digits;
    retn += TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_INTEGER_SUFFIX_CHARACTERS);
 
    return retn;
@@ -122,12 +328,13 @@ tux64_textcompiler_formatter_calculate_output_length_string(
 
    retn = TUX64_LITERAL_UINT32(0u);
 
-   retn += tux64_textcompiler_formatter_calculate_output_length_item_string_data(
+   retn += tux64_textcompiler_formatter_calculate_output_length_item_integer(
       &string->identifiers.data,
-      string->text.characters
+      TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_OFFSET_DIGITS_COUNT)
    );
    retn += tux64_textcompiler_formatter_calculate_output_length_item_integer(
-      &string->identifiers.length
+      &string->identifiers.length,
+      TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_INTEGER_DIGITS_COUNT)
    );
 
    return retn;
@@ -135,7 +342,9 @@ tux64_textcompiler_formatter_calculate_output_length_string(
 
 static Tux64UInt32
 tux64_textcompiler_formatter_calculate_output_length(
-   const struct Tux64TextCompilerLexerStringArray * string_array
+   const struct Tux64TextCompilerLexerStringArray * string_array,
+   const struct Tux64TextCompilerFormatterPool * pool,
+   const struct Tux64String * name
 ) {
    Tux64UInt32 retn;
    Tux64UInt32 i;
@@ -144,6 +353,10 @@ tux64_textcompiler_formatter_calculate_output_length(
    retn = TUX64_LITERAL_UINT32(0u);
 
    retn += TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_PRELUDE_CHARACTERS);
+   retn += tux64_textcompiler_formatter_calculate_output_length_item_pool_data(
+      name,
+      pool->characters
+   );
 
    i = string_array->length;
    iter_string_array = string_array->ptr;
@@ -176,9 +389,15 @@ tux64_textcompiler_formatter_string_character_convert(
    if (character == '.') {
       return TUX64_LITERAL_UINT8(63u);
    }
-   if (character == ' ') {
+   if (character == '/') {
       return TUX64_LITERAL_UINT8(64u);
    }
+   if (character == ':') {
+      return TUX64_LITERAL_UINT8(65u);
+   }
+   if (character == ' ') {
+      return TUX64_LITERAL_UINT8(66u);
+   }
 
    /* this should have already been filtered in the lexer */
    TUX64_UNREACHABLE;
@@ -280,13 +499,13 @@ tux64_textcompiler_formatter_generate_allocated_string_character(
 }
 
 static Tux64UInt8 *
-tux64_textcompiler_formatter_generate_allocated_string_data(
+tux64_textcompiler_formatter_generate_allocated_pool_data(
    Tux64UInt8 * output_data,
    const struct Tux64String * identifier,
-   const struct Tux64TextCompilerLexerText * text
+   const struct Tux64TextCompilerFormatterPool * pool
 ) {
    Tux64UInt8 * iter_output_data;
-   Tux64UInt8 i;
+   Tux64UInt32 i;
    const char * iter_text;
 
    iter_output_data = output_data;
@@ -295,9 +514,9 @@ tux64_textcompiler_formatter_generate_allocated_string_data(
       identifier
    );
 
-   i = (text->characters - TUX64_LITERAL_UINT8(1u));
-   iter_text = text->ptr;
-   while (i != TUX64_LITERAL_UINT8(0u)) {
+   i = (pool->characters - TUX64_LITERAL_UINT32(1u));
+   iter_text = pool->data;
+   while (i != TUX64_LITERAL_UINT32(0u)) {
       iter_output_data = tux64_textcompiler_formatter_generate_allocated_string_character(
          iter_output_data,
          *iter_text,
@@ -323,9 +542,11 @@ static Tux64UInt8 *
 tux64_textcompiler_formatter_generate_allocated_integer(
    Tux64UInt8 * output_data,
    const struct Tux64String * identifier,
-   Tux64UInt8 characters
+   Tux64UInt32 value,
+   Tux64UInt32 digits
 ) {
    Tux64UInt8 * iter_output_data;
+   Tux64UInt32 i;
 
    iter_output_data = output_data;
    iter_output_data = tux64_textcompiler_formatter_generate_allocated_preprocessor_define(
@@ -340,10 +561,16 @@ tux64_textcompiler_formatter_generate_allocated_integer(
    );
    iter_output_data += (TUX64_TEXTCOMPILER_FORMATTER_INTEGER_PREFIX_CHARACTERS * sizeof(char));
 
-   iter_output_data = tux64_textcompiler_formatter_generate_allocated_byte(
-      iter_output_data,
-      characters
-   );
+   /* one byte at a time, most significant first */
+   i = digits / TUX64_LITERAL_UINT32(2u);
+   while (i != TUX64_LITERAL_UINT32(0u)) {
+      i--;
+
+      iter_output_data = tux64_textcompiler_formatter_generate_allocated_byte(
+         iter_output_data,
+         (Tux64UInt8)(value >> (i * TUX64_LITERAL_UINT32(8u)))
+      );
+   }
 
    tux64_memory_copy(
       iter_output_data,
@@ -358,21 +585,24 @@ tux64_textcompiler_formatter_generate_allocated_integer(
 static Tux64UInt8 *
 tux64_textcompiler_formatter_generate_allocated_string(
    Tux64UInt8 * output_data,
-   const struct Tux64TextCompilerLexerString * string
+   const struct Tux64TextCompilerLexerString * string,
+   Tux64UInt32 offset
 ) {
    Tux64UInt8 * iter_output_data;
 
    iter_output_data = output_data;
 
-   iter_output_data = tux64_textcompiler_formatter_generate_allocated_string_data(
+   iter_output_data = tux64_textcompiler_formatter_generate_allocated_integer(
       iter_output_data,
       &string->identifiers.data,
-      &string->text
+      offset,
+      TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_OFFSET_DIGITS_COUNT)
    );
    iter_output_data = tux64_textcompiler_formatter_generate_allocated_integer(
       iter_output_data,
       &string->identifiers.length,
-      (Tux64UInt8)string->text.characters
+      (Tux64UInt32)string->text.characters,
+      TUX64_LITERAL_UINT32(TUX64_TEXTCOMPILER_FORMATTER_INTEGER_DIGITS_COUNT)
    );
 
    return iter_output_data;
@@ -381,11 +611,14 @@ tux64_textcompiler_formatter_generate_allocated_string(
 static void
 tux64_textcompiler_formatter_generate_allocated(
    const struct Tux64TextCompilerLexerStringArray * string_array,
+   const struct Tux64TextCompilerFormatterPool * pool,
+   const struct Tux64String * name,
    Tux64UInt8 * output_data
 ) {
    Tux64UInt8 * iter_output_data;
    Tux64UInt32 i;
    const struct Tux64TextCompilerLexerString * iter_string_array;
+   const Tux64UInt32 * iter_offsets;
 
    iter_output_data = output_data;
 
@@ -396,16 +629,25 @@ tux64_textcompiler_formatter_generate_allocated(
    );
    iter_output_data += (TUX64_TEXTCOMPILER_FORMATTER_PRELUDE_CHARACTERS * sizeof(char));
 
+   iter_output_data = tux64_textcompiler_formatter_generate_allocated_pool_data(
+      iter_output_data,
+      name,
+      pool
+   );
+
    i = string_array->length;
    iter_string_array = string_array->ptr;
+   iter_offsets = pool->offsets;
    do {
       iter_output_data = tux64_textcompiler_formatter_generate_allocated_string(
          iter_output_data,
-         iter_string_array
+         iter_string_array,
+         *iter_offsets
       );
 
       i--;
       iter_string_array++;
+      iter_offsets++;
    } while (i != TUX64_LITERAL_UINT32(0u));
 
    return;
@@ -413,28 +655,38 @@ tux64_textcompiler_formatter_generate_allocated(
 
 struct Tux64TextCompilerFormatterGenerateResult
 tux64_textcompiler_formatter_generate(
-   const struct Tux64TextCompilerLexerStringArray * string_array
+   const struct Tux64TextCompilerLexerStringArray * string_array,
+   const struct Tux64String * name
 ) {
    struct Tux64TextCompilerFormatterGenerateResult result;
+   struct Tux64TextCompilerFormatterPool pool;
    Tux64UInt32 output_bytes;
    Tux64UInt8 * output_data;
 
-   output_bytes = tux64_textcompiler_formatter_calculate_output_length(string_array) * TUX64_LITERAL_UINT32(sizeof(char));
+   if (tux64_textcompiler_formatter_pool_build(string_array, &pool) == TUX64_BOOLEAN_FALSE) {
+      result.status = TUX64_TEXTCOMPILER_FORMATTER_GENERATE_STATUS_OUT_OF_MEMORY;
+      return result;
+   }
+
+   output_bytes = tux64_textcompiler_formatter_calculate_output_length(string_array, &pool, name) * TUX64_LITERAL_UINT32(sizeof(char));
 
    output_data = (Tux64UInt8 *)malloc(output_bytes);
    if (output_data == NULL) {
+      tux64_textcompiler_formatter_pool_free(&pool);
       result.status = TUX64_TEXTCOMPILER_FORMATTER_GENERATE_STATUS_OUT_OF_MEMORY;
       return result;
    }
 
    tux64_textcompiler_formatter_generate_allocated(
       string_array,
+      &pool,
+      name,
       output_data
    );
+   tux64_textcompiler_formatter_pool_free(&pool);
 
    result.status = TUX64_TEXTCOMPILER_FORMATTER_GENERATE_STATUS_OK;
    result.payload.ok.data = output_data;
    result.payload.ok.bytes = output_bytes;
    return result;
 }
-
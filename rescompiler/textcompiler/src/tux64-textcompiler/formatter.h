@@ -33,12 +33,15 @@ struct Tux64TextCompilerFormatterGenerateResult {
 };
 
 /*----------------------------------------------------------------------------*/
-/* Generates C source code from the parsed text file.  If the 'ok' variant is */
+/* Generates C source code from the parsed text file.  All strings are        */
+/* merged into a single string pool defined as 'name', with each string's     */
+/* data identifier defining its offset into the pool.  If the 'ok' variant is */
 /* returned, then it must be manually freed with free().                      */
 /*----------------------------------------------------------------------------*/
 struct Tux64TextCompilerFormatterGenerateResult
 tux64_textcompiler_formatter_generate(
-   const struct Tux64TextCompilerLexerStringArray * string_array
+   const struct Tux64TextCompilerLexerStringArray * string_array,
+   const struct Tux64String * name
 );
 
 /*----------------------------------------------------------------------------*/
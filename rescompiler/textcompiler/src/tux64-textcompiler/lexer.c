@@ -649,6 +649,8 @@ tux64_textcompiler_lexer_fsm_string_entry_character_is_valid(
    switch (c) {
       case '%':
       case '.':
+      case '/':
+      case ':':
       case ' ':
          return TUX64_BOOLEAN_TRUE;
 
@@ -150,7 +150,7 @@ tux64_textcompiler_exit_result_display_lexer_parse_error(
       msg
    );
 
-   tux64_fs_file_unload(&self->file);
+   tux64_fs_file_unmap(&self->file);
    return;
 }
 
@@ -230,7 +230,7 @@ tux64_textcompiler_main_parsed_args(
       return result;
    }
 
-   input_file_load_result = tux64_fs_file_load(path_input_cstr);
+   input_file_load_result = tux64_fs_file_map(path_input_cstr);
    free(path_input_cstr);
 
    switch (input_file_load_result.status) {
@@ -261,7 +261,7 @@ tux64_textcompiler_main_parsed_args(
       case TUX64_TEXTCOMPILER_LEXER_PARSE_STATUS_OK:
          break;
       case TUX64_TEXTCOMPILER_LEXER_PARSE_STATUS_OUT_OF_MEMORY:
-         tux64_fs_file_unload(&input_file_load_result.payload.ok);
+         tux64_fs_file_unmap(&input_file_load_result.payload.ok);
          result.status = TUX64_TEXTCOMPILER_EXIT_STATUS_OUT_OF_MEMORY;
          return result;
       default:
@@ -277,10 +277,11 @@ tux64_textcompiler_main_parsed_args(
    );
 
    formatter_generate_result = tux64_textcompiler_formatter_generate(
-      &lexer_parse_result.payload.ok
+      &lexer_parse_result.payload.ok,
+      &args->name
    );
    tux64_textcompiler_lexer_string_array_free(&lexer_parse_result.payload.ok);
-   tux64_fs_file_unload(&input_file_load_result.payload.ok);
+   tux64_fs_file_unmap(&input_file_load_result.payload.ok);
 
    switch (formatter_generate_result.status) {
       case TUX64_TEXTCOMPILER_FORMATTER_GENERATE_STATUS_OK:
@@ -326,8 +327,8 @@ tux64_textcompiler_main_parsed_args(
       case TUX64_FS_STATUS_NOT_A_FILE:
       case TUX64_FS_STATUS_UNKNOWN_ERROR:
          result.status = TUX64_TEXTCOMPILER_EXIT_STATUS_FS_ERROR;
-         result.payload.fs_error.reason.status = input_file_load_result.status;
-         result.payload.fs_error.reason.payload = input_file_load_result.payload.err;
+         result.payload.fs_error.reason.status = output_file_save_result.status;
+         result.payload.fs_error.reason.payload = output_file_save_result.payload;
          return result;
       default:
          TUX64_UNREACHABLE;
@@ -0,0 +1,185 @@
+#!/bin/sh
+
+# ----------------------------------------------------------------------------
+#                          Copyright (c) Tux64 2026
+# ----------------------------------------------------------------------------
+# This file is licensed under the GPLv3 license.  For more information, see
+# LICENSE.
+# ----------------------------------------------------------------------------
+# scripts/benchmark.sh - Times the host tools against fixed inputs and prints
+#    the results as tab-separated values.
+# ----------------------------------------------------------------------------
+
+# Usage: benchmark.sh [iterations]
+#
+# Every benchmark runs the installed tools from ${TUX64_BUILD_ROOT}/tools/bin
+# 'iterations' times, defaulting to 10.  The resource compilers are run
+# against the bootloader's own resources, and tux64-mkrom is run against
+# synthetic inputs of a fixed size, so results can be compared between
+# commits.  One line is printed per benchmark with the following columns:
+#
+#    name, bytes, iterations, fastest run in nanoseconds, bytes per second
+#
+# where 'bytes' is the total size of the benchmark's inputs.
+
+if [ -z "${TUX64_BUILD_ROOT}" ]; then
+   echo "error: \${TUX64_BUILD_ROOT} is not set, make sure to run buildconf.sh in your current shell" 1>&2
+   exit 1
+fi
+
+bench_iterations=${1:-10}
+bench_tools=${TUX64_BUILD_ROOT}/tools/bin
+bench_resources=$(cd "$(dirname "${0}")/.." && pwd)/boot/src/tux64-boot/stage1
+bench_work=$(mktemp -d)
+trap 'rm -rf "${bench_work}"' EXIT
+
+bench_kernel_bytes=2097152
+bench_initramfs_bytes=12582912
+
+# writes big-endian integers as raw bytes
+bench_uint16() {
+   printf "$(printf '\\%03o\\%03o' \
+      $(( (${1} >> 8) & 255 )) $(( ${1} & 255 )))"
+}
+bench_uint32() {
+   printf "$(printf '\\%03o\\%03o\\%03o\\%03o' \
+      $(( (${1} >> 24) & 255 )) $(( (${1} >> 16) & 255 )) \
+      $(( (${1} >> 8) & 255 )) $(( ${1} & 255 )))"
+}
+
+# writes 'bytes' zeroes
+bench_zeroes() {
+   dd if=/dev/zero bs=${1} count=1 2>/dev/null
+}
+
+# writes a big-endian MIPS ELF executable with a single loadable segment
+bench_kernel() {
+   printf '\177ELF\001\002\001\000\000\000\000\000\000\000\000\000'
+   bench_uint16 2                   # e_type = ET_EXEC
+   bench_uint16 8                   # e_machine = EM_MIPS
+   bench_uint32 1                   # e_version
+   bench_uint32 0x80100000          # e_entry
+   bench_uint32 52                  # e_phoff
+   bench_uint32 0                   # e_shoff
+   bench_uint32 0                   # e_flags
+   bench_uint16 52                  # e_ehsize
+   bench_uint16 32                  # e_phentsize
+   bench_uint16 1                   # e_phnum
+   bench_uint16 40                  # e_shentsize
+   bench_uint16 0                   # e_shnum
+   bench_uint16 0                   # e_shstrndx
+   bench_uint32 1                   # p_type = PT_LOAD
+   bench_uint32 96                  # p_offset
+   bench_uint32 0x80100000          # p_vaddr
+   bench_uint32 0x80100000          # p_paddr
+   bench_uint32 ${1}                # p_filesz
+   bench_uint32 ${1}                # p_memsz
+   bench_uint32 7                   # p_flags
+   bench_uint32 16                  # p_align
+   bench_zeroes 12
+   bench_zeroes ${1}
+}
+
+# bench_run [name] [bytes] [command...]
+bench_run() {
+   bench_name=${1}
+   bench_bytes=${2}
+   shift 2
+
+   bench_fastest=
+   bench_iteration=0
+   while [ ${bench_iteration} -lt ${bench_iterations} ]; do
+      bench_start=$(date +%s%N)
+      if ! "$@" >/dev/null 2>&1; then
+         echo "error: benchmark ${bench_name} failed, run it by hand to see why" 1>&2
+         exit 1
+      fi
+      bench_end=$(date +%s%N)
+
+      bench_elapsed=$(( bench_end - bench_start ))
+      if [ -z "${bench_fastest}" ] || [ ${bench_elapsed} -lt ${bench_fastest} ]; then
+         bench_fastest=${bench_elapsed}
+      fi
+
+      bench_iteration=$(( bench_iteration + 1 ))
+   done
+
+   awk -v name="${bench_name}" -v bytes=${bench_bytes} -v iterations=${bench_iterations} -v fastest=${bench_fastest} \
+      'BEGIN { printf "%s\t%d\t%d\t%d\t%.0f\n", name, bytes, iterations, fastest, bytes * 1000000000 / fastest }'
+}
+
+bench_size() {
+   wc -c < "${1}" | tr -d ' '
+}
+
+cd "${bench_work}" || exit 1
+
+bench_zeroes 1024 > stage0.bin
+bench_zeroes 256 > stage0.cic
+bench_zeroes 12288 > stage1.bin
+echo 1000 > stage1.bss
+bench_zeroes 4096 > stage2.bin
+bench_kernel ${bench_kernel_bytes} > kernel.elf
+bench_zeroes ${bench_initramfs_bytes} > initramfs.img
+cat > mkrom.cfg << EOF
+--bootloader-stage0=stage0.bin
+--bootloader-stage0-cic=stage0.cic
+--bootloader-stage1=stage1.bin
+--bootloader-stage1-bss=stage1.bss
+--bootloader-stage2=stage2.bin
+--kernel=kernel.elf
+--initramfs=initramfs.img
+--command-line=console=ttyS0
+EOF
+
+bench_mkrom_bytes=$(( 1024 + 256 + 12288 + 4096 + bench_kernel_bytes + bench_initramfs_bytes ))
+
+printf 'name\tbytes\titerations\tfastest_ns\tbytes_per_second\n'
+
+bench_run fontcompiler $(bench_size "${bench_resources}/fontmap.rgb888.data") \
+   "${bench_tools}/tux64-fontcompiler" \
+      --input "${bench_resources}/fontmap.rgb888.data" \
+      --output fontmap.h \
+      --name TUX64_BENCHMARK_FONTMAP
+
+bench_run textcompiler $(bench_size "${bench_resources}/strings.txt") \
+   "${bench_tools}/tux64-textcompiler" \
+      --input "${bench_resources}/strings.txt" \
+      --output strings.h \
+      --name TUX64_BENCHMARK_STRINGS_POOL
+
+bench_run imagecompiler $(bench_size "${bench_resources}/logo.rgba8888.data") \
+   "${bench_tools}/tux64-imagecompiler" \
+      --input "${bench_resources}/logo.rgba8888.data" \
+      --output logo.h \
+      --name-pixels TUX64_BENCHMARK_LOGO_PIXELS \
+      --name-color-table TUX64_BENCHMARK_LOGO_COLOR_TABLE
+
+bench_run mkrom ${bench_mkrom_bytes} \
+   "${bench_tools}/tux64-mkrom" --config mkrom.cfg --prefix "${bench_work}/" \
+      --output mkrom.n64
+
+bench_run mkrom-jobs-${TUX64_MAKEOPTS:-1} ${bench_mkrom_bytes} \
+   "${bench_tools}/tux64-mkrom" --config mkrom.cfg --prefix "${bench_work}/" \
+      --output mkrom.n64 --jobs ${TUX64_MAKEOPTS:-1}
+
+# like the sample configuration in the installation guide, this has no
+# command line.  the second build must be able to use the first one's cache,
+# otherwise the cached benchmark below would only be measuring full builds.
+grep -v -- '--command-line' mkrom.cfg > mkrom-sample.cfg
+"${bench_tools}/tux64-mkrom" --config mkrom-sample.cfg --prefix "${bench_work}/" \
+   --output mkrom-sample.n64 --cache mkrom-sample.cache >/dev/null 2>&1
+if ! "${bench_tools}/tux64-mkrom" --config mkrom-sample.cfg --prefix "${bench_work}/" \
+   --output mkrom-sample.n64 --cache mkrom-sample.cache 2>&1 | grep -q 'updating ROM image'; then
+   echo "error: tux64-mkrom didn't use the ROM cache from the previous build" 1>&2
+   exit 1
+fi
+
+# the first run creates the cache, so every timed run after it finds nothing
+# to rewrite.
+"${bench_tools}/tux64-mkrom" --config mkrom.cfg --prefix "${bench_work}/" \
+   --output mkrom-cached.n64 --cache mkrom-cached.cache >/dev/null 2>&1
+bench_run mkrom-cached ${bench_mkrom_bytes} \
+   "${bench_tools}/tux64-mkrom" --config mkrom.cfg --prefix "${bench_work}/" \
+      --output mkrom-cached.n64 --cache mkrom-cached.cache
+
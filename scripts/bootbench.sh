@@ -0,0 +1,116 @@
+#!/bin/sh
+
+# ----------------------------------------------------------------------------
+#                          Copyright (c) Tux64 2026
+# ----------------------------------------------------------------------------
+# This file is licensed under the GPLv3 license.  For more information, see
+# LICENSE.
+# ----------------------------------------------------------------------------
+# scripts/bootbench.sh - Boots a ROM image in the patched Ares until the
+#    kernel prints a marker, and compares the time taken against a baseline.
+# ----------------------------------------------------------------------------
+
+# Usage: bootbench.sh [rom] [baseline] [--update]
+#
+# Boots 'rom' in ${TUX64_BUILD_ROOT}/tools/bin/ares with no video, audio or
+# input, and stops as soon as the kernel prints the marker through the PI
+# serial port.  The ROM is booted with RDRAM left uninitialized and the IPL2
+# checksum enforced, like on real hardware.  A header row and one line are
+# printed with the following tab-separated columns:
+#
+#    name, cycles, milliseconds, frames, baseline cycles, change in percent
+#
+# where 'cycles' is the number of emulated CPU cycles from power-on to the
+# marker, and 'frames' is that converted to 60Hz video frames.  If 'baseline'
+# exists, it holds the cycle count of a previous run, and we exit with an
+# error if the ROM got slower by more than ${TUX64_BOOTBENCH_TOLERANCE}
+# percent, defaulting to 1.  If '--update' is given, the baseline is
+# overwritten with this run instead.
+#
+# The following environment variables change how the ROM is booted:
+#
+#    TUX64_BOOTBENCH_MARKER - The text to wait for, defaulting to the kernel's
+#       first printk(), "Linux version".
+#    TUX64_BOOTBENCH_TIMEOUT - How many seconds to wait before giving up,
+#       defaulting to 300.
+
+if [ -z "${TUX64_BUILD_ROOT}" ]; then
+   echo "error: \${TUX64_BUILD_ROOT} is not set, make sure to run buildconf.sh in your current shell" 1>&2
+   exit 1
+fi
+
+bench_rom=${1:-${TUX64_BUILD_ROOT}/builds/tux64-rom-image/tux64.n64}
+bench_baseline=${2}
+bench_update=${3}
+bench_marker=${TUX64_BOOTBENCH_MARKER:-Linux version}
+bench_timeout=${TUX64_BOOTBENCH_TIMEOUT:-300}
+bench_tolerance=${TUX64_BOOTBENCH_TOLERANCE:-1}
+
+# the same clock rate the binary trace port uses, and NTSC's field rate
+bench_clock_rate=93750000
+bench_frame_rate=60
+
+if [ ! -f "${bench_rom}" ]; then
+   echo "error: ROM image ${bench_rom} doesn't exist" 1>&2
+   exit 1
+fi
+
+# Ares has no way to run without a window, so use a virtual display if there
+# isn't a real one.
+bench_display=
+if [ -z "${DISPLAY}" ] && [ -z "${WAYLAND_DISPLAY}" ]; then
+   if ! command -v xvfb-run >/dev/null 2>&1; then
+      echo "error: no display is available, install xvfb-run to run headless" 1>&2
+      exit 1
+   fi
+   bench_display="xvfb-run -a"
+fi
+
+bench_output=$(
+   TUX64_ARES_BENCHMARK="${bench_marker}" timeout ${bench_timeout} \
+      ${bench_display} "${TUX64_BUILD_ROOT}/tools/bin/ares" \
+         --system "Nintendo 64" \
+         --no-file-prompt \
+         --setting Video/Driver=None \
+         --setting Audio/Driver=None \
+         --setting Input/Driver=None \
+         --setting Video/Blocking=false \
+         --setting Audio/Blocking=false \
+         --setting Nintendo64/InitializeRdram=false \
+         --setting Nintendo64/EnforceIpl2Checksum=true \
+         "${bench_rom}" 2>/dev/null
+)
+
+bench_cycles=$(echo "${bench_output}" | awk '$1 == "tux64-benchmark" && $2 == "cycles" { print $3 }')
+if [ -z "${bench_cycles}" ]; then
+   echo "error: \"${bench_marker}\" wasn't printed before Ares exited or ${bench_timeout} seconds passed" 1>&2
+   exit 1
+fi
+
+if [ "${bench_update}" = "--update" ] && [ -n "${bench_baseline}" ]; then
+   echo "${bench_cycles}" > "${bench_baseline}"
+fi
+
+bench_baseline_cycles=
+if [ -n "${bench_baseline}" ] && [ -f "${bench_baseline}" ]; then
+   bench_baseline_cycles=$(cat "${bench_baseline}")
+fi
+
+awk -v name="$(basename "${bench_rom}")" -v cycles=${bench_cycles} -v baseline="${bench_baseline_cycles}" \
+   -v clock=${bench_clock_rate} -v rate=${bench_frame_rate} -v tolerance=${bench_tolerance} '
+   BEGIN {
+      change = 0
+      if (baseline != "") {
+         change = (cycles - baseline) * 100 / baseline
+      }
+
+      printf "name\tcycles\tmilliseconds\tframes\tbaseline_cycles\tchange_percent\n"
+      printf "%s\t%d\t%.3f\t%.1f\t%s\t%.2f\n", name, cycles, cycles * 1000 / clock, cycles * rate / clock, baseline, change
+      fflush()
+
+      if (baseline != "" && change > tolerance) {
+         printf "error: boot time regressed by %.2f%%, more than the allowed %s%%\n", change, tolerance > "/dev/stderr"
+         exit 1
+      }
+   }
+'
@@ -0,0 +1,111 @@
+/*----------------------------------------------------------------------------*/
+/*                          Copyright (C) Tux64 2026                          */
+/*                    https://github.com/bradleycha/tux64                     */
+/*----------------------------------------------------------------------------*/
+/* scripts/pagefault-init.c - A page-fault-heavy /init for benchmarking the   */
+/* kernel with scripts/bootbench.sh.                                          */
+/*----------------------------------------------------------------------------*/
+
+/* this is built by scripts/pagefault-initramfs.sh.  every round maps a */
+/* fresh region and touches each page, so the kernel has to clear them, then */
+/* forks a child which writes to each page again, so the kernel has to copy */
+/* them.  once every round is done, the marker is written to the kernel log, */
+/* which bootbench.sh waits for. */
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/mount.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define PAGEFAULT_INIT_ROUNDS\
+   (16u)
+#define PAGEFAULT_INIT_REGION_BYTES\
+   (1048576u)
+#define PAGEFAULT_INIT_MARKER\
+   "tux64: page fault workload finished\n"
+
+static void
+pagefault_init_touch(
+   volatile unsigned char * region,
+   unsigned char value
+) {
+   unsigned long page_bytes;
+   unsigned long i;
+
+   page_bytes = (unsigned long)sysconf(_SC_PAGESIZE);
+
+   i = 0u;
+   while (i < PAGEFAULT_INIT_REGION_BYTES) {
+      region[i] = value;
+      i += page_bytes;
+   }
+
+   return;
+}
+
+static int
+pagefault_init_round(void) {
+   unsigned char * region;
+   pid_t child;
+   int status;
+
+   region = mmap(NULL, PAGEFAULT_INIT_REGION_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (region == MAP_FAILED) {
+      return -1;
+   }
+
+   /* each page is cleared on its first write */
+   pagefault_init_touch(region, 1u);
+
+   child = fork();
+   if (child == 0) {
+      /* each page is shared with the parent, so it's copied on write */
+      pagefault_init_touch(region, 2u);
+      _exit(0);
+   }
+   if (child < 0) {
+      (void)munmap(region, PAGEFAULT_INIT_REGION_BYTES);
+      return -1;
+   }
+
+   (void)waitpid(child, &status, 0);
+   (void)munmap(region, PAGEFAULT_INIT_REGION_BYTES);
+   return 0;
+}
+
+int main(void) {
+   unsigned int i;
+   int kmsg;
+
+   /* the initramfs is only this binary, so bring up /dev ourselves.  these */
+   /* fail harmlessly when it already exists */
+   (void)mkdir("/dev", 0755);
+   (void)mount("devtmpfs", "/dev", "devtmpfs", 0, NULL);
+
+   i = 0u;
+   while (i != PAGEFAULT_INIT_ROUNDS) {
+      if (pagefault_init_round() != 0) {
+         return 1;
+      }
+      i++;
+   }
+
+   kmsg = open("/dev/kmsg", O_WRONLY);
+   if (kmsg < 0) {
+      return 1;
+   }
+   (void)write(kmsg, PAGEFAULT_INIT_MARKER, strlen(PAGEFAULT_INIT_MARKER));
+   (void)close(kmsg);
+
+   /* the kernel panics if init exits, which would race with the marker */
+   if (getpid() != 1) {
+      return 0;
+   }
+   while (1) {
+      (void)pause();
+   }
+}
+
@@ -0,0 +1,45 @@
+#!/bin/sh
+
+# ----------------------------------------------------------------------------
+#                          Copyright (c) Tux64 2026
+# ----------------------------------------------------------------------------
+# This file is licensed under the GPLv3 license.  For more information, see
+# LICENSE.
+# ----------------------------------------------------------------------------
+# scripts/pagefault-initramfs.sh - Creates an initramfs which runs a
+#    page-fault-heavy workload, for comparing kernels with bootbench.sh.
+# ----------------------------------------------------------------------------
+
+# Usage: pagefault-initramfs.sh [output]
+#
+# Builds scripts/pagefault-init.c with the ${TUX64_TARGET_N64_LINUX} cross
+# compiler as a static /init, and writes an initramfs containing only that to
+# 'output', defaulting to pagefault-initramfs.cpio.  Once booted, /init clears
+# and copies 16MiB worth of pages each, then prints the following line, which
+# can be passed to bootbench.sh with TUX64_BOOTBENCH_MARKER:
+#
+#    tux64: page fault workload finished
+
+if [ -z "${TUX64_BUILD_ROOT}" ]; then
+   echo "error: \${TUX64_BUILD_ROOT} is not set, make sure to run buildconf.sh in your current shell" 1>&2
+   exit 1
+fi
+
+initramfs_output=$(realpath -m "${1:-pagefault-initramfs.cpio}")
+initramfs_source=$(cd "$(dirname "${0}")" && pwd)/pagefault-init.c
+initramfs_work=$(mktemp -d)
+trap 'rm -rf "${initramfs_work}"' EXIT
+
+if ! command -v cpio >/dev/null 2>&1; then
+   echo "error: cpio is required to create the initramfs" 1>&2
+   exit 1
+fi
+
+"${TUX64_BUILD_ROOT}/tools/bin/${TUX64_TARGET_N64_LINUX}-gcc" \
+   ${TUX64_CFLAGS_N64_LINUX} \
+   ${TUX64_LDFLAGS_N64_LINUX} \
+   -static \
+   -o "${initramfs_work}/init" \
+   "${initramfs_source}" || exit 1
+
+(cd "${initramfs_work}" && echo init | cpio -o -H newc --quiet > "${initramfs_output}") || exit 1
@@ -0,0 +1,136 @@
+#!/bin/sh
+
+# ----------------------------------------------------------------------------
+#                          Copyright (c) Tux64 2026
+# ----------------------------------------------------------------------------
+# This file is licensed under the GPLv3 license.  For more information, see
+# LICENSE.
+# ----------------------------------------------------------------------------
+# scripts/tracedecode.sh - Converts a binary trace written by the patched
+#    Ares PI trace port into Chrome trace JSON.
+# ----------------------------------------------------------------------------
+
+# Usage: tracedecode.sh [trace] [names]
+#
+# Reads 'trace', defaulting to tux64-trace.bin, and prints the events as
+# Chrome trace JSON, which can be opened as a flame chart in Perfetto or
+# chrome://tracing.  Each event is a single 32-bit word written to PI address
+# 0x05000024, laid out as follows:
+#
+#    bits 31-30 - kind, 0 = instant, 1 = begin, 2 = end, 3 = counter
+#    bits 29-20 - event ID
+#    bits 19-0  - payload
+#
+# Begin and end events with the same ID are paired into a single slice, and
+# counter events are drawn as a graph of their payload.  Slices are written
+# as async events keyed by their event ID, so they don't need to nest, for
+# example a PI DMA which ends partway through a checksum.  An ID must end
+# before it begins again.  'names' is an optional file with one "ID name" pair
+# per line, which are used instead of the raw event IDs.
+
+trace_file=${1:-tux64-trace.bin}
+trace_names=${2}
+
+if [ ! -f "${trace_file}" ]; then
+   echo "error: trace file ${trace_file} doesn't exist" 1>&2
+   exit 1
+fi
+
+if [ -n "${trace_names}" ] && [ ! -f "${trace_names}" ]; then
+   echo "error: names file ${trace_names} doesn't exist" 1>&2
+   exit 1
+fi
+
+od -An -v -tu1 "${trace_file}" | awk -v names="${trace_names}" '
+   # the header is the magic string "TUX64TRC", the version and the clock rate
+   function header() {
+      magic = sprintf("%c%c%c%c%c%c%c%c", b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7])
+      if (magic != "TUX64TRC") {
+         print "error: not a tux64 trace file" > "/dev/stderr"
+         failed = 1
+         exit 1
+      }
+      if (word(8) != 1) {
+         print "error: unsupported trace version " word(8) > "/dev/stderr"
+         failed = 1
+         exit 1
+      }
+      clock = word(12)
+   }
+
+   function word(offset) {
+      return ((b[offset] * 256 + b[offset + 1]) * 256 + b[offset + 2]) * 256 + b[offset + 3]
+   }
+
+   function record(   ts, event, kind, id, payload, name, phase) {
+      ts = (word(0) * 4294967296 + word(4)) * 1000000 / clock
+      event = word(8)
+      kind = int(event / 1073741824)
+      id = int(event / 1048576) % 1024
+      payload = event % 1048576
+
+      name = (id in name_of) ? name_of[id] : "event " id
+      phase = substr("ibeC", kind + 1, 1)
+
+      printf "%s\n{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":1", separator, name, phase, ts
+      if (phase == "i") {
+         printf ",\"s\":\"p\""
+      }
+      if (phase == "b" || phase == "e") {
+         printf ",\"cat\":\"tux64\",\"id\":%d", id
+      }
+      if (phase == "C") {
+         printf ",\"args\":{\"value\":%d}}", payload
+      } else {
+         printf ",\"args\":{\"payload\":%d}}", payload
+      }
+      separator = ","
+   }
+
+   BEGIN {
+      if (names != "") {
+         while ((getline line < names) > 0) {
+            split(line, field, " ")
+            if (field[1] != "") {
+               name_of[field[1] + 0] = substr(line, index(line, field[2]))
+            }
+         }
+      }
+
+      count = 0
+      header_done = 0
+      separator = ""
+   }
+
+   {
+      i = 1
+      while (i <= NF) {
+         b[count] = $i
+         count++
+
+         if (!header_done && count == 16) {
+            header()
+            header_done = 1
+            printf "{\"displayTimeUnit\":\"ns\",\"traceEvents\":["
+            count = 0
+         }
+         if (header_done && count == 12) {
+            record()
+            count = 0
+         }
+
+         i++
+      }
+   }
+
+   END {
+      if (failed) {
+         exit 1
+      }
+      if (!header_done) {
+         print "error: trace file is truncated" > "/dev/stderr"
+         exit 1
+      }
+      printf "\n]}\n"
+   }
+'